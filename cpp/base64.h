@@ -0,0 +1,286 @@
+#ifndef MLC_BASE64_H_
+#define MLC_BASE64_H_
+
+#include <array>
+#include <cstdint>
+
+#if defined(__x86_64__) || defined(_M_X64)
+#define MLC_BASE64_AVX2 1
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define MLC_BASE64_TARGET_AVX2
+#else
+#define MLC_BASE64_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+#define MLC_BASE64_NEON 1
+#include <arm_neon.h>
+#endif
+
+namespace mlc {
+namespace registry {
+namespace base64 {
+
+inline constexpr char kEncTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+inline constexpr uint8_t kInvalid = 0xFF;
+
+inline const std::array<uint8_t, 256> &DecTable() {
+  static const std::array<uint8_t, 256> table = []() {
+    std::array<uint8_t, 256> ret;
+    ret.fill(kInvalid);
+    for (int i = 0; i < 64; ++i) {
+      ret[static_cast<uint8_t>(kEncTable[i])] = static_cast<uint8_t>(i);
+    }
+    return ret;
+  }();
+  return table;
+}
+
+inline int64_t EncodedSize(int64_t len) { return ((len + 2) / 3) * 4; }
+
+/****************** Scalar ******************/
+
+// Encodes `len` bytes, where `len` is a multiple of 3
+inline void EncodeScalar(const uint8_t *src, int64_t len, uint8_t *dst) {
+  for (int64_t i = 0; i < len; i += 3, dst += 4) {
+    uint32_t chunk = (static_cast<uint32_t>(src[i]) << 16) | (static_cast<uint32_t>(src[i + 1]) << 8) | src[i + 2];
+    dst[0] = kEncTable[(chunk >> 18) & 0x3F];
+    dst[1] = kEncTable[(chunk >> 12) & 0x3F];
+    dst[2] = kEncTable[(chunk >> 6) & 0x3F];
+    dst[3] = kEncTable[chunk & 0x3F];
+  }
+}
+
+// Decodes `len` characters, where `len` is a multiple of 4. Padding `=` is skipped wherever it appears. Returns the
+// number of bytes written, or -1 if an invalid character is found.
+inline int64_t DecodeScalar(const uint8_t *src, int64_t len, uint8_t *dst) {
+  const std::array<uint8_t, 256> &table = DecTable();
+  uint8_t *out = dst;
+  for (int64_t i = 0; i < len; i += 4) {
+    uint8_t v0 = table[src[i]], v1 = table[src[i + 1]], v2 = table[src[i + 2]], v3 = table[src[i + 3]];
+    if (((v0 | v1 | v2 | v3) & 0xC0) == 0) {
+      uint32_t accum = (static_cast<uint32_t>(v0) << 18) | (static_cast<uint32_t>(v1) << 12) |
+                       (static_cast<uint32_t>(v2) << 6) | v3;
+      out[0] = static_cast<uint8_t>(accum >> 16);
+      out[1] = static_cast<uint8_t>(accum >> 8);
+      out[2] = static_cast<uint8_t>(accum);
+      out += 3;
+      continue;
+    }
+    // Slow path for blocks with padding
+    uint32_t accum = 0;
+    int valid_chars = 0;
+    for (int j = 0; j < 4; ++j) {
+      if (uint8_t c = src[i + j]; c != '=') {
+        if (uint8_t v = table[c]; v != kInvalid) {
+          accum = (accum << 6) | v;
+          ++valid_chars;
+        } else {
+          return -1;
+        }
+      }
+    }
+    int total_bits = valid_chars * 6;
+    accum <<= (24 - total_bits);
+    for (int b = 0; b < total_bits / 8; ++b) {
+      *out++ = static_cast<uint8_t>((accum >> (16 - 8 * b)) & 0xFF);
+    }
+  }
+  return out - dst;
+}
+
+/****************** AVX2 ******************/
+
+#if MLC_BASE64_AVX2
+inline bool HasAVX2() {
+#if defined(_MSC_VER)
+  int info[4];
+  __cpuid(info, 0);
+  if (info[0] < 7) {
+    return false;
+  }
+  __cpuid(info, 1);
+  bool os_saves_ymm = (info[2] & (1 << 27)) && (_xgetbv(0) & 0x6) == 0x6; // OSXSAVE, and XMM/YMM state enabled
+  __cpuidex(info, 7, 0);
+  return os_saves_ymm && (info[1] & (1 << 5));
+#else
+  __builtin_cpu_init();
+  return __builtin_cpu_supports("avx2");
+#endif
+}
+
+// Encodes 24 bytes per iteration into 32 characters, see http://0x80.pl/notesen/2016-01-12-sse-base64-encoding.html.
+// Returns the number of bytes consumed, a multiple of 3; reads up to 4 bytes past them.
+MLC_BASE64_TARGET_AVX2 inline int64_t EncodeAVX2(const uint8_t *src, int64_t len, uint8_t *dst) {
+  // Spread each group of 3 bytes [s0, s1, s2] over a 32-bit lane as [s1, s0, s2, s1]
+  const __m256i shuffle = _mm256_setr_epi8(1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10, //
+                                           1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+  // Offsets from a 6-bit value to its character, indexed by the value's range: A-Z, a-z, 0-9 (x10), +, /
+  const __m256i offsets = _mm256_setr_epi8(65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0, //
+                                           65, 71, -4, -4, -4, -4, -4, -4, -4, -4, -4, -4, -19, -16, 0, 0);
+  int64_t i = 0;
+  for (; i + 28 <= len; i += 24, dst += 32) {
+    __m128i lo = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i));
+    __m128i hi = _mm_loadu_si128(reinterpret_cast<const __m128i *>(src + i + 12));
+    __m256i in = _mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1), shuffle);
+    // Move the 6-bit values to bytes 0 (a), 2 (c) with `mulhi`, and to bytes 1 (b), 3 (d) with `mullo`
+    __m256i ac = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0FC0FC00)), _mm256_set1_epi32(0x04000040));
+    __m256i bd = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003F03F0)), _mm256_set1_epi32(0x01000010));
+    __m256i values = _mm256_or_si256(ac, bd);
+    __m256i ranges = _mm256_subs_epu8(values, _mm256_set1_epi8(51));
+    ranges = _mm256_sub_epi8(ranges, _mm256_cmpgt_epi8(values, _mm256_set1_epi8(25)));
+    __m256i chars = _mm256_add_epi8(values, _mm256_shuffle_epi8(offsets, ranges));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), chars);
+  }
+  return i;
+}
+
+// Decodes 32 characters per iteration into 24 bytes, see http://0x80.pl/notesen/2016-01-17-sse-base64-decoding.html.
+// Stops before the first block that holds padding or an invalid character. Returns the number of characters consumed,
+// a multiple of 32; writes up to 8 bytes past the decoded ones.
+MLC_BASE64_TARGET_AVX2 inline int64_t DecodeAVX2(const uint8_t *src, int64_t len, uint8_t *dst) {
+  // Each character is valid iff the bit sets selected by its low and high nibbles are disjoint
+  const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+                                          0x1B, 0x1B, 0x1B, 0x1A, //
+                                          0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A,
+                                          0x1B, 0x1B, 0x1B, 0x1A);
+  const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                                          0x10, 0x10, 0x10, 0x10, //
+                                          0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10,
+                                          0x10, 0x10, 0x10, 0x10);
+  // Offsets from a character to its 6-bit value, indexed by the high nibble, except that '/' goes to index 1
+  const __m256i lut_roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0, //
+                                            0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+  const __m256i mask_2f = _mm256_set1_epi8(0x2F);
+  const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1, //
+                                        2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+  int64_t i = 0;
+  for (; i + 32 <= len; i += 32, dst += 24) {
+    __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(src + i));
+    __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(in, 4), mask_2f);
+    __m256i lo_nibbles = _mm256_and_si256(in, mask_2f);
+    if (!_mm256_testz_si256(_mm256_shuffle_epi8(lut_lo, lo_nibbles), _mm256_shuffle_epi8(lut_hi, hi_nibbles))) {
+      break;
+    }
+    __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(_mm256_cmpeq_epi8(in, mask_2f), hi_nibbles));
+    __m256i values = _mm256_add_epi8(in, roll);
+    // Merge each group of 4 6-bit values into 24 bits, then pack the 3-byte groups together
+    __m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+    merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+    merged = _mm256_shuffle_epi8(merged, pack);
+    merged = _mm256_permutevar8x32_epi32(merged, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 7, 7));
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(dst), merged);
+  }
+  return i;
+}
+#endif // MLC_BASE64_AVX2
+
+/****************** NEON ******************/
+
+#if MLC_BASE64_NEON
+// Encodes 48 bytes per iteration into 64 characters. Returns the number of bytes consumed, a multiple of 3.
+inline int64_t EncodeNEON(const uint8_t *src, int64_t len, uint8_t *dst) {
+  uint8x16x4_t table;
+  for (int k = 0; k < 4; ++k) {
+    table.val[k] = vld1q_u8(reinterpret_cast<const uint8_t *>(kEncTable) + 16 * k);
+  }
+  const uint8x16_t mask_6 = vdupq_n_u8(0x3F);
+  int64_t i = 0;
+  for (; i + 48 <= len; i += 48, dst += 64) {
+    uint8x16x3_t in = vld3q_u8(src + i);
+    uint8x16x4_t out;
+    out.val[0] = vshrq_n_u8(in.val[0], 2);
+    out.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[0], 4), vshrq_n_u8(in.val[1], 4)), mask_6);
+    out.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(in.val[1], 2), vshrq_n_u8(in.val[2], 6)), mask_6);
+    out.val[3] = vandq_u8(in.val[2], mask_6);
+    for (int k = 0; k < 4; ++k) {
+      out.val[k] = vqtbl4q_u8(table, out.val[k]);
+    }
+    vst4q_u8(dst, out);
+  }
+  return i;
+}
+
+// Decodes 64 characters per iteration into 48 bytes. Stops before the first block that holds padding or an invalid
+// character. Returns the number of characters consumed, a multiple of 64.
+inline int64_t DecodeNEON(const uint8_t *src, int64_t len, uint8_t *dst) {
+  const std::array<uint8_t, 256> &dec = DecTable();
+  uint8x16x4_t table_lo, table_hi;
+  for (int k = 0; k < 4; ++k) {
+    table_lo.val[k] = vld1q_u8(dec.data() + 16 * k);
+    table_hi.val[k] = vld1q_u8(dec.data() + 64 + 16 * k);
+  }
+  const uint8x16_t bit_6 = vdupq_n_u8(0x40);
+  int64_t i = 0;
+  for (; i + 64 <= len; i += 64, dst += 48) {
+    uint8x16x4_t in = vld4q_u8(src + i);
+    uint8x16_t error = vdupq_n_u8(0);
+    for (int k = 0; k < 4; ++k) {
+      // Out-of-range indices give 0, so each character is looked up in exactly one of the tables, unless it is
+      // non-ASCII, which is then flagged by its top bit
+      uint8x16_t c = in.val[k];
+      in.val[k] = vorrq_u8(vqtbl4q_u8(table_lo, c), vqtbl4q_u8(table_hi, veorq_u8(c, bit_6)));
+      error = vorrq_u8(error, vorrq_u8(in.val[k], c));
+    }
+    if (vmaxvq_u8(vandq_u8(error, vdupq_n_u8(0x80))) != 0) {
+      break;
+    }
+    uint8x16x3_t out;
+    out.val[0] = vorrq_u8(vshlq_n_u8(in.val[0], 2), vshrq_n_u8(in.val[1], 4));
+    out.val[1] = vorrq_u8(vshlq_n_u8(in.val[1], 4), vshrq_n_u8(in.val[2], 2));
+    out.val[2] = vorrq_u8(vshlq_n_u8(in.val[2], 6), in.val[3]);
+    vst3q_u8(dst, out);
+  }
+  return i;
+}
+#endif // MLC_BASE64_NEON
+
+/****************** Dispatch ******************/
+
+// Writes `EncodedSize(len)` characters to `dst`
+inline void Encode(const uint8_t *src, int64_t len, uint8_t *dst) {
+  int64_t i = 0;
+#if MLC_BASE64_AVX2
+  static const bool has_avx2 = HasAVX2();
+  if (has_avx2) {
+    i = EncodeAVX2(src, len, dst);
+  }
+#elif MLC_BASE64_NEON
+  i = EncodeNEON(src, len, dst);
+#endif
+  dst += i / 3 * 4;
+  int64_t num_full = (len - i) / 3 * 3;
+  EncodeScalar(src + i, num_full, dst);
+  src += i + num_full;
+  dst += num_full / 3 * 4;
+  if (int64_t rest = len - i - num_full; rest > 0) {
+    uint32_t chunk = static_cast<uint32_t>(src[0]) << 16 | (rest == 2 ? static_cast<uint32_t>(src[1]) << 8 : 0);
+    dst[0] = kEncTable[(chunk >> 18) & 0x3F];
+    dst[1] = kEncTable[(chunk >> 12) & 0x3F];
+    dst[2] = rest == 2 ? kEncTable[(chunk >> 6) & 0x3F] : '=';
+    dst[3] = '=';
+  }
+}
+
+// Decodes `len` characters, a multiple of 4, to `dst`, which must have room for 8 bytes more than `len / 4 * 3`.
+// Returns the number of bytes written, or -1 if an invalid character is found.
+inline int64_t Decode(const uint8_t *src, int64_t len, uint8_t *dst) {
+  int64_t i = 0;
+#if MLC_BASE64_AVX2
+  static const bool has_avx2 = HasAVX2();
+  if (has_avx2) {
+    i = DecodeAVX2(src, len, dst);
+  }
+#elif MLC_BASE64_NEON
+  i = DecodeNEON(src, len, dst);
+#endif
+  int64_t num_bytes = DecodeScalar(src + i, len - i, dst + i / 4 * 3);
+  return num_bytes < 0 ? -1 : i / 4 * 3 + num_bytes;
+}
+
+} // namespace base64
+} // namespace registry
+} // namespace mlc
+
+#endif // MLC_BASE64_H_
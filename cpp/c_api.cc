@@ -1,4 +1,5 @@
 #include "./registry.h"
+#include <atomic>
 #include <mlc/core/all.h>
 
 namespace mlc {
@@ -50,6 +51,12 @@ using ::mlc::registry::TypeTable;
 
 namespace {
 thread_local Any last_error;
+std::atomic<int32_t> traceback_enabled{1};
+#ifdef MLC_DISABLE_TRACEBACK
+constexpr bool kTracebackCompiledIn = false;
+#else
+constexpr bool kTracebackCompiledIn = true;
+#endif
 } // namespace
 
 MLC_API MLCAny MLCGetLastError() {
@@ -58,6 +65,19 @@ MLC_API MLCAny MLCGetLastError() {
   return ret;
 }
 
+// `MLC_DISABLE_TRACEBACK` is checked here rather than in the inline `TracebackHere`, so that code built against
+// the headers without the define agrees with libmlc
+MLC_API int32_t MLCTracebackGetEnabled() {
+  return kTracebackCompiledIn && traceback_enabled.load(std::memory_order_relaxed);
+}
+
+MLC_API int32_t MLCTracebackSetEnabled(int32_t enabled) {
+  if (!kTracebackCompiledIn) {
+    return 0;
+  }
+  return traceback_enabled.exchange(enabled != 0, std::memory_order_relaxed);
+}
+
 MLC_API int32_t MLCTypeRegister(MLCTypeTableHandle _self, int32_t parent_type_index, const char *type_key,
                                 int32_t type_index, MLCTypeInfo **out_type_info) {
   MLC_SAFE_CALL_BEGIN();
@@ -1,91 +1,332 @@
+#include "./thread_pool.h"
 #include <algorithm>
 #include <cctype>
 #include <cmath>
+#include <cstring>
+#include <functional>
+#include <initializer_list>
 #include <map>
+#include <memory>
 #include <mlc/printer/all.h>
 #include <sstream>
+#include <streambuf>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace mlc {
 namespace printer {
 namespace {
 using ByteSpan = std::pair<size_t, size_t>;
 
+// Output buffer of `DocPrinter`, kept as a list of fixed-size chunks so that appending never moves text already
+// written and the current position is known in O(1). Without a sink, the chunks are joined once by `ToStr`. With a
+// sink, each chunk is handed over as soon as it fills up, except for trailing whitespace, which is held back until
+// more text follows so that it can be dropped at the end like `ToStr` does.
+class PrinterOutput : public std::streambuf {
+public:
+  using Sink = std::function<void(const char *data, size_t size)>;
+  static constexpr size_t kChunkSize = 1 << 16;
+
+  explicit PrinterOutput(Sink sink) : sink_(std::move(sink)) { this->NewChunk(); }
+
+  bool IsStreaming() const { return this->sink_ != nullptr; }
+  size_t Tell() const { return this->num_sealed_ + static_cast<size_t>(this->pptr() - this->pbase()); }
+
+  // Returns the text written so far without trailing whitespace
+  ::mlc::Str ToStr() const {
+    size_t size = this->Tell();
+    while (size > 0 && std::isspace(static_cast<unsigned char>(this->At(size - 1)))) {
+      --size;
+    }
+    ::mlc::Str ret(::mlc::core::StrPad::Allocator::NewWithPad<uint8_t>(size + 1, static_cast<int64_t>(size)));
+    char *out = ret.get()->::MLCStr::data;
+    this->CopyTo(out, size);
+    out[size] = '\0';
+    return ret;
+  }
+
+  // Appends the first `size` bytes written so far to `out`
+  void CopyTo(std::string *out, size_t size) const {
+    size_t offset = out->size();
+    out->resize(offset + size);
+    this->CopyTo(out->data() + offset, size);
+  }
+
+  // Copies the first `size` bytes written so far to `out`
+  void CopyTo(char *out, size_t size) const {
+    for (size_t i = 0; size > 0; ++i) {
+      size_t n = std::min(kChunkSize, size);
+      std::memcpy(out, this->chunks_[i].get(), n);
+      out += n;
+      size -= n;
+    }
+  }
+
+  // Hands the remaining text over to the sink, dropping trailing whitespace
+  void Finish() {
+    this->Emit(this->pbase(), static_cast<size_t>(this->pptr() - this->pbase()));
+    this->pending_.clear();
+  }
+
+protected:
+  int_type overflow(int_type ch) override {
+    this->num_sealed_ += kChunkSize;
+    if (this->IsStreaming()) {
+      this->Emit(this->pbase(), kChunkSize);
+      this->setp(this->pbase(), this->pbase() + kChunkSize);
+    } else {
+      this->NewChunk();
+    }
+    if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+      *this->pptr() = traits_type::to_char_type(ch);
+      this->pbump(1);
+    }
+    return traits_type::not_eof(ch);
+  }
+
+private:
+  char At(size_t pos) const { return this->chunks_[pos / kChunkSize][pos % kChunkSize]; }
+
+  void NewChunk() {
+    this->chunks_.emplace_back(new char[kChunkSize]);
+    char *begin = this->chunks_.back().get();
+    this->setp(begin, begin + kChunkSize);
+  }
+
+  // Trailing whitespace is held back until more text follows, so that it can be dropped at the end, and so is a
+  // multi-byte UTF-8 character cut by the chunk boundary, so that every piece handed to the sink decodes on its own
+  void Emit(const char *data, size_t size) {
+    size_t end = size;
+    while (end > 0 && std::isspace(static_cast<unsigned char>(data[end - 1]))) {
+      --end;
+    }
+    if (end == size) {
+      end -= IncompleteUTF8Suffix(data, size);
+    }
+    if (end > 0 && this->pending_.empty()) {
+      this->sink_(data, end);
+    } else if (end > 0) {
+      this->pending_.append(data, end);
+      this->sink_(this->pending_.data(), this->pending_.size());
+      this->pending_.clear();
+    }
+    this->pending_.append(data + end, size - end);
+  }
+
+  // Length of the trailing bytes of `data` that start a UTF-8 character without completing it
+  static size_t IncompleteUTF8Suffix(const char *data, size_t size) {
+    size_t i = size;
+    while (i > 0 && size - i < 3 && (static_cast<unsigned char>(data[i - 1]) & 0xC0) == 0x80) {
+      --i;
+    }
+    if (i == 0) {
+      return 0;
+    }
+    unsigned char lead = static_cast<unsigned char>(data[i - 1]);
+    size_t len = (lead & 0xE0) == 0xC0 ? 2 : (lead & 0xF0) == 0xE0 ? 3 : (lead & 0xF8) == 0xF0 ? 4 : 1;
+    size_t have = size - i + 1;
+    return have < len ? have : 0;
+  }
+
+  Sink sink_;
+  std::vector<std::unique_ptr<char[]>> chunks_;
+  size_t num_sealed_ = 0;
+  std::string pending_;
+};
+
+// Flat table keyed by type index, spanning the contiguous range of indices it is built from. The printer's doc types
+// get their indices when they register, so tables are filled on first use instead of at compile time.
+template <typename Value> class FlatTypeTable {
+public:
+  FlatTypeTable(std::initializer_list<std::pair<int32_t, Value>> entries, Value missing) : missing_(missing) {
+    int32_t end = 0;
+    begin_ = entries.size() == 0 ? 0 : entries.begin()->first;
+    for (const auto &kv : entries) {
+      begin_ = std::min(begin_, kv.first);
+      end = std::max(end, kv.first + 1);
+    }
+    values_.assign(end > begin_ ? static_cast<size_t>(end - begin_) : 0, missing);
+    for (const auto &kv : entries) {
+      values_[kv.first - begin_] = kv.second;
+    }
+  }
+
+  Value Get(int32_t type_index) const {
+    size_t i = static_cast<size_t>(static_cast<uint32_t>(type_index - begin_));
+    return i < values_.size() ? values_[i] : missing_;
+  }
+
+private:
+  int32_t begin_;
+  Value missing_;
+  std::vector<Value> values_;
+};
+
+// Trie over the segments of the paths to underline, where each node stands for a prefix shared by some of them.
+// A source path is resolved to its node via the node of its `prev`, memoized by path object, so matching a doc node
+// against all paths to underline costs O(1) per segment not seen before, rather than a scan with `IsPrefixOf`.
+class PathTrie {
+public:
+  using ObjectPathObj = ::mlc::core::ObjectPathObj;
+
+  PathTrie() : nodes_(1) {}
+
+  void Insert(const ObjectPathObj *path, int32_t target) {
+    std::vector<const ObjectPathObj *> segments;
+    for (const ObjectPathObj *p = path; p; p = p->prev.DynCast<ObjectPathObj>()) {
+      segments.push_back(p);
+    }
+    int32_t node = 0;
+    for (auto it = segments.rbegin(); it != segments.rend(); ++it) {
+      int32_t child = this->FindChild(node, *it);
+      if (child == -1) {
+        child = static_cast<int32_t>(nodes_.size());
+        nodes_.push_back(TrieNode{node, *it, {}});
+        children_.emplace(ChildHash(node, *it), child);
+      }
+      nodes_[child].targets.push_back(target);
+      node = child;
+    }
+  }
+
+  // Indices of the paths to underline that `path` is a prefix of, or nullptr if there are none
+  const std::vector<int32_t> *Match(const ObjectPathObj *path) {
+    if (nodes_.size() == 1) {
+      return nullptr;
+    }
+    int32_t node = this->Resolve(path);
+    return node > 0 ? &nodes_[node].targets : nullptr;
+  }
+
+  // The memo is keyed by address, so it is only valid while the paths looked up are alive
+  void ClearCache() { cache_.clear(); }
+
+private:
+  struct TrieNode {
+    int32_t parent;
+    const ObjectPathObj *segment;
+    std::vector<int32_t> targets;
+  };
+
+  static uint64_t ChildHash(int32_t parent, const ObjectPathObj *segment) {
+    return ::mlc::base::HashCombine(static_cast<uint64_t>(parent), segment->SegmentHash());
+  }
+
+  int32_t FindChild(int32_t parent, const ObjectPathObj *segment) const {
+    auto range = children_.equal_range(ChildHash(parent, segment));
+    for (auto it = range.first; it != range.second; ++it) {
+      const TrieNode &child = nodes_[it->second];
+      if (child.parent == parent && child.segment->SegmentEqual(segment)) {
+        return it->second;
+      }
+    }
+    return -1;
+  }
+
+  int32_t Resolve(const ObjectPathObj *path) {
+    // Walk up until a path with a known node, then resolve the segments below it top-down
+    std::vector<const ObjectPathObj *> pending;
+    int32_t node = 0;
+    for (const ObjectPathObj *p = path; p; p = p->prev.DynCast<ObjectPathObj>()) {
+      if (auto it = cache_.find(p); it != cache_.end()) {
+        node = it->second;
+        break;
+      }
+      pending.push_back(p);
+    }
+    for (auto it = pending.rbegin(); it != pending.rend(); ++it) {
+      node = node == -1 ? -1 : this->FindChild(node, *it);
+      cache_[*it] = node;
+    }
+    return node;
+  }
+
+  std::vector<TrieNode> nodes_;
+  std::unordered_multimap<uint64_t, int32_t> children_;
+  std::unordered_map<const ObjectPathObj *, int32_t> cache_;
+};
+
 class DocPrinter {
 public:
-  explicit DocPrinter(const PrinterConfig &options);
+  explicit DocPrinter(const PrinterConfig &options, PrinterOutput::Sink sink = nullptr);
   virtual ~DocPrinter() = default;
 
   void Append(const Node &doc);
   void Append(const Node &doc, const PrinterConfig &cfg);
   ::mlc::Str GetString() const;
+  void Finish() { buffer_.Finish(); }
+  // Appends the text as is, without trimming or decoration
+  void AppendRawText(std::string *out) const { buffer_.CopyTo(out, buffer_.Tell()); }
 
 protected:
   void PrintDoc(const Node &doc);
-  virtual void PrintTypedDoc(const Literal &doc) = 0;
-  virtual void PrintTypedDoc(const Id &doc) = 0;
-  virtual void PrintTypedDoc(const Attr &doc) = 0;
-  virtual void PrintTypedDoc(const Index &doc) = 0;
-  virtual void PrintTypedDoc(const Operation &doc) = 0;
-  virtual void PrintTypedDoc(const Call &doc) = 0;
-  virtual void PrintTypedDoc(const Lambda &doc) = 0;
-  virtual void PrintTypedDoc(const List &doc) = 0;
-  virtual void PrintTypedDoc(const Tuple &doc) = 0;
-  virtual void PrintTypedDoc(const Dict &doc) = 0;
-  virtual void PrintTypedDoc(const Slice &doc) = 0;
-  virtual void PrintTypedDoc(const StmtBlock &doc) = 0;
-  virtual void PrintTypedDoc(const Assign &doc) = 0;
-  virtual void PrintTypedDoc(const If &doc) = 0;
-  virtual void PrintTypedDoc(const While &doc) = 0;
-  virtual void PrintTypedDoc(const For &doc) = 0;
-  virtual void PrintTypedDoc(const With &doc) = 0;
-  virtual void PrintTypedDoc(const ExprStmt &doc) = 0;
-  virtual void PrintTypedDoc(const Assert &doc) = 0;
-  virtual void PrintTypedDoc(const Return &doc) = 0;
-  virtual void PrintTypedDoc(const Function &doc) = 0;
-  virtual void PrintTypedDoc(const Class &doc) = 0;
-  virtual void PrintTypedDoc(const Comment &doc) = 0;
-  virtual void PrintTypedDoc(const DocString &doc) = 0;
-
+  virtual void PrintTypedDoc(const LiteralObj *doc) = 0;
+  virtual void PrintTypedDoc(const IdObj *doc) = 0;
+  virtual void PrintTypedDoc(const AttrObj *doc) = 0;
+  virtual void PrintTypedDoc(const IndexObj *doc) = 0;
+  virtual void PrintTypedDoc(const OperationObj *doc) = 0;
+  virtual void PrintTypedDoc(const CallObj *doc) = 0;
+  virtual void PrintTypedDoc(const LambdaObj *doc) = 0;
+  virtual void PrintTypedDoc(const ListObj *doc) = 0;
+  virtual void PrintTypedDoc(const TupleObj *doc) = 0;
+  virtual void PrintTypedDoc(const DictObj *doc) = 0;
+  virtual void PrintTypedDoc(const SliceObj *doc) = 0;
+  virtual void PrintTypedDoc(const StmtBlockObj *doc) = 0;
+  virtual void PrintTypedDoc(const AssignObj *doc) = 0;
+  virtual void PrintTypedDoc(const IfObj *doc) = 0;
+  virtual void PrintTypedDoc(const WhileObj *doc) = 0;
+  virtual void PrintTypedDoc(const ForObj *doc) = 0;
+  virtual void PrintTypedDoc(const WithObj *doc) = 0;
+  virtual void PrintTypedDoc(const ExprStmtObj *doc) = 0;
+  virtual void PrintTypedDoc(const AssertObj *doc) = 0;
+  virtual void PrintTypedDoc(const ReturnObj *doc) = 0;
+  virtual void PrintTypedDoc(const FunctionObj *doc) = 0;
+  virtual void PrintTypedDoc(const ClassObj *doc) = 0;
+  virtual void PrintTypedDoc(const CommentObj *doc) = 0;
+  virtual void PrintTypedDoc(const DocStringObj *doc) = 0;
+
+  using PrintFn = void (*)(DocPrinter *, const NodeObj *);
+  template <typename TObj> static void PrintAs(DocPrinter *printer, const NodeObj *doc) {
+    printer->PrintTypedDoc(reinterpret_cast<const TObj *>(doc));
+  }
+  template <typename... TObjs> static FlatTypeTable<PrintFn> MakeVTable() {
+    return FlatTypeTable<PrintFn>({{TObjs::_type_index, &DocPrinter::PrintAs<TObjs>}...}, nullptr);
+  }
   void PrintTypedDoc(const NodeObj *doc) {
-    using PrinterVTable = std::unordered_map<int32_t, std::function<void(DocPrinter *, const NodeObj *)>>;
-    // clang-format off
-    #define MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Type) { Type::TObj::_type_index, [](DocPrinter *printer, const NodeObj *doc) { printer->PrintTypedDoc(Type(doc->DynCast<Type::TObj>())); } }
-    // clang-format on
-    static PrinterVTable vtable{
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Literal),   MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Id),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Attr),      MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Index),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Operation), MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Call),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Lambda),    MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(List),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Tuple),     MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Dict),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Slice),     MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(StmtBlock),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Assign),    MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(If),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(While),     MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(For),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(With),      MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(ExprStmt),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Assert),    MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Return),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Function),  MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Class),
-        MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(Comment),   MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_(DocString),
-    };
-    // clang-format off
-    #undef MLC_PRINTER_PRINT_TYPED_DOC_ENTRY_
-    // clang-format on
-    vtable.at(doc->GetTypeIndex())(this, doc);
+    static const FlatTypeTable<PrintFn> vtable = MakeVTable<
+        LiteralObj, IdObj, AttrObj, IndexObj, OperationObj, CallObj, LambdaObj, ListObj, TupleObj, DictObj, SliceObj,
+        StmtBlockObj, AssignObj, IfObj, WhileObj, ForObj, WithObj, ExprStmtObj, AssertObj, ReturnObj, FunctionObj,
+        ClassObj, CommentObj, DocStringObj>();
+    if (PrintFn fn = vtable.Get(doc->GetTypeIndex())) {
+      fn(this, doc);
+    } else {
+      MLC_THROW(TypeError) << "Unsupported doc type: " << doc->GetTypeKey();
+    }
   }
   void IncreaseIndent() { indent_ += options_->indent_spaces; }
   void DecreaseIndent() { indent_ -= options_->indent_spaces; }
   std::ostream &NewLine() {
-    size_t start_pos = output_.tellp();
+    size_t start_pos = buffer_.Tell();
     output_ << "\n";
-    line_starts_.push_back(output_.tellp());
+    if (!buffer_.IsStreaming()) {
+      line_starts_.push_back(buffer_.Tell());
+    }
     for (int i = 0; i < indent_; ++i) {
       output_ << ' ';
     }
-    size_t end_pos = output_.tellp();
-    underlines_exempted_.push_back({start_pos, end_pos});
+    ExemptUnderline({start_pos, buffer_.Tell()});
     return output_;
   }
-  std::ostringstream output_;
+  // Line numbers and underlines are not supported when streaming, so no span needs to be tracked
+  void ExemptUnderline(const ByteSpan &span) {
+    if (!buffer_.IsStreaming()) {
+      underlines_exempted_.push_back(span);
+    }
+  }
+  PrinterOutput buffer_;
+  std::ostream output_;
   std::vector<ByteSpan> underlines_exempted_;
 
 private:
@@ -96,6 +337,7 @@ private:
   int indent_ = 0;
   std::vector<size_t> line_starts_;
   mlc::List<ObjectPath> path_to_underline_;
+  PathTrie path_trie_;
   std::vector<std::vector<ByteSpan>> current_underline_candidates_;
   std::vector<int> current_max_path_length_;
   std::vector<ByteSpan> underlines_;
@@ -195,15 +437,17 @@ enum class ExprPrecedence : int32_t {
   kIdentity = 15,
 };
 
-inline ExprPrecedence GetExprPrecedence(const Expr &doc) {
+inline ExprPrecedence GetExprPrecedence(const Object *doc) {
   // Key is the type index of Doc
-  static const std::unordered_map<uint32_t, ExprPrecedence> doc_type_precedence = {
-      {LiteralObj::_type_index, ExprPrecedence::kIdentity}, {IdObj::_type_index, ExprPrecedence::kIdentity},
-      {AttrObj::_type_index, ExprPrecedence::kIdentity},    {IndexObj::_type_index, ExprPrecedence::kIdentity},
-      {CallObj::_type_index, ExprPrecedence::kIdentity},    {LambdaObj::_type_index, ExprPrecedence::kLambda},
-      {TupleObj::_type_index, ExprPrecedence::kIdentity},   {ListObj::_type_index, ExprPrecedence::kIdentity},
-      {DictObj::_type_index, ExprPrecedence::kIdentity},
-  };
+  static const FlatTypeTable<ExprPrecedence> doc_type_precedence(
+      {
+          {LiteralObj::_type_index, ExprPrecedence::kIdentity}, {IdObj::_type_index, ExprPrecedence::kIdentity},
+          {AttrObj::_type_index, ExprPrecedence::kIdentity},    {IndexObj::_type_index, ExprPrecedence::kIdentity},
+          {CallObj::_type_index, ExprPrecedence::kIdentity},    {LambdaObj::_type_index, ExprPrecedence::kLambda},
+          {TupleObj::_type_index, ExprPrecedence::kIdentity},   {ListObj::_type_index, ExprPrecedence::kIdentity},
+          {DictObj::_type_index, ExprPrecedence::kIdentity},
+      },
+      ExprPrecedence::kUnkown);
   // Key is the value of OperationDocNode::Kind
   static const std::vector<ExprPrecedence> op_kind_precedence = []() {
     using OpKind = OperationObj::Kind;
@@ -233,8 +477,9 @@ inline ExprPrecedence GetExprPrecedence(const Expr &doc) {
       MLC_THROW(ValueError) << "Unknown precedence for operator: " << op_doc->op;
     }
     return precedence;
-  } else if (auto it = doc_type_precedence.find(doc->GetTypeIndex()); it != doc_type_precedence.end()) {
-    return it->second;
+  } else if (ExprPrecedence precedence = doc_type_precedence.Get(doc->GetTypeIndex());
+             precedence != ExprPrecedence::kUnkown) {
+    return precedence;
   }
   MLC_THROW(ValueError) << "Unknown precedence for doc type: " << doc->GetTypeKey();
   MLC_UNREACHABLE();
@@ -419,6 +664,9 @@ inline size_t GetLineNumberWidth(size_t num_lines, const PrinterConfig &options)
 
 inline mlc::Str DecorateText(const mlc::Str &text, const std::vector<size_t> &line_starts, const PrinterConfig &options,
                              const std::vector<ByteSpan> &underlines) {
+  if (underlines.empty() && !options->print_line_numbers) {
+    return text;
+  }
   size_t num_lines = GetNumLines(text, line_starts);
   size_t line_number_width = GetLineNumberWidth(num_lines, options);
 
@@ -459,45 +707,51 @@ inline mlc::Str DecorateText(const mlc::Str &text, const std::vector<size_t> &li
   return ret.str();
 }
 
-inline DocPrinter::DocPrinter(const PrinterConfig &options) : options_(options) { line_starts_.push_back(0); }
+inline DocPrinter::DocPrinter(const PrinterConfig &options, PrinterOutput::Sink sink)
+    : buffer_(std::move(sink)), output_(&buffer_), options_(options) {
+  // Let errors raised by the sink propagate instead of being swallowed by the stream
+  output_.exceptions(std::ios::badbit);
+  line_starts_.push_back(0);
+}
 
 inline void DocPrinter::Append(const Node &doc) { Append(doc, PrinterConfig()); }
 
 inline void DocPrinter::Append(const Node &doc, const PrinterConfig &cfg) {
   for (ObjectPath p : cfg->path_to_underline) {
+    path_trie_.Insert(p.get(), static_cast<int32_t>(path_to_underline_.size()));
     path_to_underline_.push_back(p);
     current_max_path_length_.push_back(0);
     current_underline_candidates_.push_back(std::vector<ByteSpan>());
   }
   PrintDoc(doc);
+  path_trie_.ClearCache();
   for (const auto &c : current_underline_candidates_) {
     underlines_.insert(underlines_.end(), c.begin(), c.end());
   }
 }
 
 inline ::mlc::Str DocPrinter::GetString() const {
-  mlc::Str text = output_.str();
-  // Remove any trailing indentation
-  while (!text->empty() && std::isspace(text->back())) {
-    text->pop_back();
-  }
+  // Trailing indentation is removed by `ToStr`
+  mlc::Str text = buffer_.ToStr();
   return DecorateText(text, line_starts_, options_, MergeAndExemptSpans(underlines_, underlines_exempted_));
 }
 
 inline void DocPrinter::PrintDoc(const Node &doc) {
-  size_t start_pos = output_.tellp();
+  size_t start_pos = buffer_.Tell();
   this->PrintTypedDoc(doc.get());
-  size_t end_pos = output_.tellp();
+  size_t end_pos = buffer_.Tell();
   for (ObjectPath path : doc->source_paths) {
     MarkSpan({start_pos, end_pos}, path);
   }
 }
 
 inline void DocPrinter::MarkSpan(const ByteSpan &span, const ObjectPath &path) {
-  int n = static_cast<int>(path_to_underline_.size());
-  for (int i = 0; i < n; ++i) {
-    ObjectPath p = path_to_underline_[i];
-    if (path->length >= current_max_path_length_[i] && path->IsPrefixOf(p.get())) {
+  const std::vector<int32_t> *targets = path_trie_.Match(path.get());
+  if (targets == nullptr) {
+    return;
+  }
+  for (int32_t i : *targets) {
+    if (path->length >= current_max_path_length_[i]) {
       if (path->length > current_max_path_length_[i]) {
         current_max_path_length_[i] = static_cast<int>(path->length);
         current_underline_candidates_[i].clear();
@@ -509,42 +763,43 @@ inline void DocPrinter::MarkSpan(const ByteSpan &span, const ObjectPath &path) {
 
 class PythonDocPrinter : public DocPrinter {
 public:
-  explicit PythonDocPrinter(const PrinterConfig &options) : DocPrinter(options) {}
+  explicit PythonDocPrinter(const PrinterConfig &options, PrinterOutput::Sink sink = nullptr)
+      : DocPrinter(options, std::move(sink)) {}
 
 protected:
   using DocPrinter::PrintDoc;
 
-  void PrintTypedDoc(const Literal &doc) final;
-  void PrintTypedDoc(const Id &doc) final;
-  void PrintTypedDoc(const Attr &doc) final;
-  void PrintTypedDoc(const Index &doc) final;
-  void PrintTypedDoc(const Operation &doc) final;
-  void PrintTypedDoc(const Call &doc) final;
-  void PrintTypedDoc(const Lambda &doc) final;
-  void PrintTypedDoc(const List &doc) final;
-  void PrintTypedDoc(const Dict &doc) final;
-  void PrintTypedDoc(const Tuple &doc) final;
-  void PrintTypedDoc(const Slice &doc) final;
-  void PrintTypedDoc(const StmtBlock &doc) final;
-  void PrintTypedDoc(const Assign &doc) final;
-  void PrintTypedDoc(const If &doc) final;
-  void PrintTypedDoc(const While &doc) final;
-  void PrintTypedDoc(const For &doc) final;
-  void PrintTypedDoc(const ExprStmt &doc) final;
-  void PrintTypedDoc(const Assert &doc) final;
-  void PrintTypedDoc(const Return &doc) final;
-  void PrintTypedDoc(const With &doc) final;
-  void PrintTypedDoc(const Function &doc) final;
-  void PrintTypedDoc(const Class &doc) final;
-  void PrintTypedDoc(const Comment &doc) final;
-  void PrintTypedDoc(const DocString &doc) final;
+  void PrintTypedDoc(const LiteralObj *doc) final;
+  void PrintTypedDoc(const IdObj *doc) final;
+  void PrintTypedDoc(const AttrObj *doc) final;
+  void PrintTypedDoc(const IndexObj *doc) final;
+  void PrintTypedDoc(const OperationObj *doc) final;
+  void PrintTypedDoc(const CallObj *doc) final;
+  void PrintTypedDoc(const LambdaObj *doc) final;
+  void PrintTypedDoc(const ListObj *doc) final;
+  void PrintTypedDoc(const DictObj *doc) final;
+  void PrintTypedDoc(const TupleObj *doc) final;
+  void PrintTypedDoc(const SliceObj *doc) final;
+  void PrintTypedDoc(const StmtBlockObj *doc) final;
+  void PrintTypedDoc(const AssignObj *doc) final;
+  void PrintTypedDoc(const IfObj *doc) final;
+  void PrintTypedDoc(const WhileObj *doc) final;
+  void PrintTypedDoc(const ForObj *doc) final;
+  void PrintTypedDoc(const ExprStmtObj *doc) final;
+  void PrintTypedDoc(const AssertObj *doc) final;
+  void PrintTypedDoc(const ReturnObj *doc) final;
+  void PrintTypedDoc(const WithObj *doc) final;
+  void PrintTypedDoc(const FunctionObj *doc) final;
+  void PrintTypedDoc(const ClassObj *doc) final;
+  void PrintTypedDoc(const CommentObj *doc) final;
+  void PrintTypedDoc(const DocStringObj *doc) final;
 
 private:
   void NewLineWithoutIndent() {
-    size_t start_pos = output_.tellp();
+    size_t start_pos = buffer_.Tell();
     output_ << "\n";
-    size_t end_pos = output_.tellp();
-    underlines_exempted_.push_back({start_pos, end_pos});
+    size_t end_pos = buffer_.Tell();
+    ExemptUnderline({start_pos, end_pos});
   }
 
   template <typename DocType> void PrintJoinedDocs(const mlc::List<DocType> &docs, const char *separator) {
@@ -584,7 +839,7 @@ private:
    * \brief Print expression and add parenthesis if needed.
    */
   void PrintChildExpr(const Expr &doc, ExprPrecedence parent_precedence, bool parenthesis_for_same_precedence = false) {
-    ExprPrecedence doc_precedence = GetExprPrecedence(doc);
+    ExprPrecedence doc_precedence = GetExprPrecedence(doc.get());
     if (doc_precedence < parent_precedence ||
         (parenthesis_for_same_precedence && doc_precedence == parent_precedence)) {
       output_ << "(";
@@ -598,7 +853,7 @@ private:
   /*!
    * \brief Print expression and add parenthesis if doc has lower precedence than parent.
    */
-  void PrintChildExpr(const Expr &doc, const Expr &parent, bool parenthesis_for_same_precedence = false) {
+  void PrintChildExpr(const Expr &doc, const Object *parent, bool parenthesis_for_same_precedence = false) {
     ExprPrecedence parent_precedence = GetExprPrecedence(parent);
     return PrintChildExpr(doc, parent_precedence, parenthesis_for_same_precedence);
   }
@@ -610,28 +865,28 @@ private:
    * by parenthesis even if it has the same precedence as its parent, e.g., the `b` in `a + b`
    * and the `b` and `c` in `a if b else c`.
    */
-  void PrintChildExprConservatively(const Expr &doc, const Expr &parent) {
+  void PrintChildExprConservatively(const Expr &doc, const Object *parent) {
     PrintChildExpr(doc, parent, /*parenthesis_for_same_precedence=*/true);
   }
 
-  void MaybePrintCommentInline(const Stmt &stmt) {
+  template <typename TStmtObj> void MaybePrintCommentInline(const TStmtObj *stmt) {
     if (const mlc::StrObj *comment = stmt->comment.get()) {
       bool has_newline = std::find(comment->begin(), comment->end(), '\n') != comment->end();
       if (has_newline) {
         MLC_THROW(ValueError) << "ValueError: Comment string of " << stmt->GetTypeKey()
                               << " cannot have newline, but got: " << comment;
       }
-      size_t start_pos = output_.tellp();
+      size_t start_pos = buffer_.Tell();
       output_ << "  # " << comment->data();
-      size_t end_pos = output_.tellp();
-      underlines_exempted_.push_back({start_pos, end_pos});
+      size_t end_pos = buffer_.Tell();
+      ExemptUnderline({start_pos, end_pos});
     }
   }
 
-  void MaybePrintCommenMultiLines(const Stmt &stmt, bool new_line = false) {
+  template <typename TStmtObj> void MaybePrintCommenMultiLines(const TStmtObj *stmt, bool new_line = false) {
     if (const mlc::StrObj *comment = stmt->comment.get()) {
       bool first_line = true;
-      size_t start_pos = output_.tellp();
+      size_t start_pos = buffer_.Tell();
       for (const std::string_view &line : comment->Split('\n')) {
         if (first_line) {
           output_ << "# " << line;
@@ -640,8 +895,8 @@ private:
           NewLine() << "# " << line;
         }
       }
-      size_t end_pos = output_.tellp();
-      underlines_exempted_.push_back({start_pos, end_pos});
+      size_t end_pos = buffer_.Tell();
+      ExemptUnderline({start_pos, end_pos});
       if (new_line) {
         NewLine();
       }
@@ -649,7 +904,7 @@ private:
   }
 
   void PrintDocString(const mlc::Str &comment) {
-    size_t start_pos = output_.tellp();
+    size_t start_pos = buffer_.Tell();
     output_ << "\"\"\"";
     for (const std::string_view &line : comment->Split('\n')) {
       if (line.empty()) {
@@ -660,8 +915,8 @@ private:
       }
     }
     NewLine() << "\"\"\"";
-    size_t end_pos = output_.tellp();
-    underlines_exempted_.push_back({start_pos, end_pos});
+    size_t end_pos = buffer_.Tell();
+    ExemptUnderline({start_pos, end_pos});
   }
   void PrintBlockComment(const mlc::Str &comment) {
     IncreaseIndent();
@@ -671,7 +926,7 @@ private:
   }
 };
 
-inline void PythonDocPrinter::PrintTypedDoc(const Literal &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const LiteralObj *doc) {
   Any value = doc->value;
   int32_t type_index = value.GetTypeIndex();
   if (!value.defined()) {
@@ -716,14 +971,14 @@ inline void PythonDocPrinter::PrintTypedDoc(const Literal &doc) {
   }
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Id &doc) { output_ << doc->name; }
+inline void PythonDocPrinter::PrintTypedDoc(const IdObj *doc) { output_ << doc->name; }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Attr &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const AttrObj *doc) {
   PrintChildExpr(doc->obj, doc);
   output_ << "." << doc->name;
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Index &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const IndexObj *doc) {
   PrintChildExpr(doc->obj, doc);
   if (doc->idx.size() == 0) {
     output_ << "[()]";
@@ -734,7 +989,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const Index &doc) {
   }
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Operation &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const OperationObj *doc) {
   using OpKind = OperationObj::Kind;
   if (doc->op < OpKind::kUnaryEnd) {
     // Unary Operators
@@ -776,7 +1031,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const Operation &doc) {
   }
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Call &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const CallObj *doc) {
   PrintChildExpr(doc->callee, doc);
   output_ << "(";
   // Print positional args
@@ -808,20 +1063,20 @@ inline void PythonDocPrinter::PrintTypedDoc(const Call &doc) {
   output_ << ")";
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Lambda &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const LambdaObj *doc) {
   output_ << "lambda ";
   PrintJoinedDocs(doc->args, ", ");
   output_ << ": ";
   PrintChildExpr(doc->body, doc);
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const List &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const ListObj *doc) {
   output_ << "[";
   PrintJoinedDocs(doc->values, ", ");
   output_ << "]";
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Tuple &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const TupleObj *doc) {
   output_ << "(";
   if (doc->values.size() == 1) {
     PrintDoc(doc->values[0]);
@@ -832,7 +1087,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const Tuple &doc) {
   output_ << ")";
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Dict &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const DictObj *doc) {
   if (doc->keys.size() != doc->values.size()) {
     MLC_THROW(ValueError) << "DictDoc should have equal number of elements in keys and values.";
   }
@@ -850,7 +1105,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const Dict &doc) {
   output_ << "}";
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Slice &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const SliceObj *doc) {
   if (doc->start != nullptr) {
     PrintDoc(doc->start.value());
   }
@@ -864,7 +1119,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const Slice &doc) {
   }
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const StmtBlock &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const StmtBlockObj *doc) {
   bool is_first = true;
   for (Stmt stmt : doc->stmts) {
     if (is_first) {
@@ -876,7 +1131,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const StmtBlock &doc) {
   }
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Assign &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const AssignObj *doc) {
   bool lhs_empty = false;
   if (const auto *tuple_doc = doc->lhs->as<TupleObj>()) {
     if (tuple_doc->values.size() == 0) {
@@ -914,7 +1169,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const Assign &doc) {
   MaybePrintCommentInline(doc);
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const If &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const IfObj *doc) {
   MaybePrintCommenMultiLines(doc, true);
   output_ << "if ";
   PrintDoc(doc->cond);
@@ -927,7 +1182,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const If &doc) {
   }
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const While &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const WhileObj *doc) {
   MaybePrintCommenMultiLines(doc, true);
   output_ << "while ";
   PrintDoc(doc->cond);
@@ -935,7 +1190,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const While &doc) {
   PrintIndentedBlock(doc->body);
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const For &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const ForObj *doc) {
   MaybePrintCommenMultiLines(doc, true);
   output_ << "for ";
   if (const auto *tuple = doc->lhs->as<TupleObj>()) {
@@ -954,7 +1209,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const For &doc) {
   PrintIndentedBlock(doc->body);
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const With &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const WithObj *doc) {
   MaybePrintCommenMultiLines(doc, true);
   output_ << "with ";
   PrintDoc(doc->rhs);
@@ -967,12 +1222,12 @@ inline void PythonDocPrinter::PrintTypedDoc(const With &doc) {
   PrintIndentedBlock(doc->body);
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const ExprStmt &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const ExprStmtObj *doc) {
   PrintDoc(doc->expr);
   MaybePrintCommentInline(doc);
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Assert &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const AssertObj *doc) {
   output_ << "assert ";
   PrintDoc(doc->cond);
   if (doc->msg.defined()) {
@@ -982,7 +1237,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const Assert &doc) {
   MaybePrintCommentInline(doc);
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Return &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const ReturnObj *doc) {
   output_ << "return";
   if (doc->value.defined()) {
     output_ << " ";
@@ -991,7 +1246,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const Return &doc) {
   MaybePrintCommentInline(doc);
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Function &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const FunctionObj *doc) {
   PrintDecorators(doc->decorators);
   output_ << "def ";
   PrintDoc(doc->name);
@@ -1010,7 +1265,7 @@ inline void PythonDocPrinter::PrintTypedDoc(const Function &doc) {
   NewLineWithoutIndent();
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Class &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const ClassObj *doc) {
   PrintDecorators(doc->decorators);
   output_ << "class ";
   PrintDoc(doc->name);
@@ -1021,13 +1276,13 @@ inline void PythonDocPrinter::PrintTypedDoc(const Class &doc) {
   PrintIndentedBlock(doc->body);
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const Comment &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const CommentObj *doc) {
   if (doc->comment.defined()) {
     MaybePrintCommenMultiLines(doc, false);
   }
 }
 
-inline void PythonDocPrinter::PrintTypedDoc(const DocString &doc) {
+inline void PythonDocPrinter::PrintTypedDoc(const DocStringObj *doc) {
   if (doc->comment.defined()) {
     mlc::Str comment(doc->comment.value());
     if (!comment->empty()) {
@@ -1055,5 +1310,80 @@ mlc::Str DocToPythonScript(mlc::printer::Node node, mlc::printer::PrinterConfig
   }
   return result;
 }
+
+// Serial printing of the module is formatting all statements of all items as one block, where consecutive statements
+// are separated by a newline at zero indentation. Formatting items separately and joining them the same way before
+// trimming the trailing whitespace yields the same bytes.
+Str ToPythonModule(UList items, mlc::printer::PrinterConfig cfg, int32_t num_threads) {
+  using namespace mlc::printer;
+  int64_t num_items = items.size();
+  ThreadPool pool(num_threads);
+  // Step 1. Convert each top-level item to statements, each with its own `IRPrinter` frame and name table
+  std::vector<mlc::List<Stmt>> stmts(num_items);
+  pool.ParallelFor(num_items, [&](int64_t i, int32_t) {
+    Node doc = ToDoc(items[i].operator ObjectRef(), cfg);
+    if (const auto *block = doc.as<StmtBlockObj>()) {
+      stmts[i] = block->stmts;
+    } else if (const auto *expr = doc.as<ExprObj>()) {
+      stmts[i] = mlc::List<Stmt>{ExprStmt(mlc::List<ObjectPath>{}, Optional<Str>{}, Expr(expr))};
+    } else if (const auto *stmt = doc.as<StmtObj>()) {
+      stmts[i] = mlc::List<Stmt>{Stmt(stmt)};
+    } else {
+      MLC_THROW(ValueError) << "Unsupported type: " << doc;
+    }
+  });
+  // Step 2. Line numbers and underlines are laid out over the full text, so the module is formatted as a whole
+  if (cfg->print_line_numbers || !cfg->path_to_underline->empty()) {
+    mlc::List<Stmt> all;
+    for (const mlc::List<Stmt> &item : stmts) {
+      all->insert(all.size(), item->begin(), item->end());
+    }
+    return DocToPythonScript(StmtBlock(mlc::List<ObjectPath>{}, Optional<Str>{}, all), cfg);
+  }
+  // Step 3. Format each item into its own buffer
+  std::vector<std::string> texts(num_items);
+  pool.ParallelFor(num_items, [&](int64_t i, int32_t) {
+    if (!stmts[i]->empty()) {
+      printer::PythonDocPrinter printer(cfg);
+      printer.Append(StmtBlock(mlc::List<ObjectPath>{}, Optional<Str>{}, stmts[i]), cfg);
+      printer.AppendRawText(&texts[i]);
+    }
+  });
+  // Step 4. Join the buffers in order
+  size_t total_size = 0;
+  for (const std::string &text : texts) {
+    total_size += text.size() + 1;
+  }
+  std::string ret;
+  ret.reserve(total_size);
+  bool is_first = true;
+  for (int64_t i = 0; i < num_items; ++i) {
+    if (stmts[i]->empty()) {
+      continue;
+    }
+    if (!is_first) {
+      ret.push_back('\n');
+    }
+    is_first = false;
+    ret.append(texts[i]);
+  }
+  while (!ret.empty() && std::isspace(static_cast<unsigned char>(ret.back()))) {
+    ret.pop_back();
+  }
+  return Str(std::move(ret));
+}
+
+void DocToPythonScriptStream(mlc::printer::Node node, mlc::printer::PrinterConfig cfg, Func write) {
+  auto sink = [&write](const char *data, size_t size) { write(mlc::Str(std::string(data, size))); };
+  if (cfg->print_line_numbers || !cfg->path_to_underline->empty()) {
+    // Line numbers and underlines are laid out over the full text, so it cannot be streamed
+    mlc::Str text = DocToPythonScript(node, cfg);
+    sink(text->data(), static_cast<size_t>(text->size()));
+    return;
+  }
+  printer::PythonDocPrinter printer(cfg, sink);
+  printer.Append(node, cfg);
+  printer.Finish();
+}
 } // namespace registry
 } // namespace mlc
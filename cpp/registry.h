@@ -20,20 +20,28 @@ namespace registry {
 
 Any JSONLoads(AnyView json_str);
 Any JSONDeserialize(AnyView json_str);
-Str JSONSerialize(AnyView source);
-bool StructuralEqual(AnyView lhs, AnyView rhs, bool bind_free_vars, bool assert_mode);
-int64_t StructuralHash(AnyView root);
-Optional<Str> StructuralEqualFailReason(AnyView lhs, AnyView rhs, bool bind_free_vars);
+Str JSONSerialize(AnyView source, bool dedup_tensor_content);
+bool StructuralEqual(AnyView lhs, AnyView rhs, bool bind_free_vars, bool assert_mode, bool tensor_content);
+int64_t StructuralHash(AnyView root, bool tensor_content);
+Optional<Str> StructuralEqualFailReason(AnyView lhs, AnyView rhs, bool bind_free_vars, bool tensor_content);
+UList StructuralDiff(AnyView lhs, AnyView rhs, bool bind_free_vars, bool tensor_content, int64_t max_diffs);
+core::ObjectPath ObjectPathIntern(const core::ObjectPathObj *prev, int32_t kind, Any key);
 Any CopyShallow(AnyView root);
-Any CopyDeep(AnyView root);
+Any CopyDeep(AnyView root, bool share_frozen, int32_t num_threads);
 void CopyReplace(int32_t num_args, const AnyView *args, Any *ret);
 Str DocToPythonScript(mlc::printer::Node node, mlc::printer::PrinterConfig cfg);
+void DocToPythonScriptStream(mlc::printer::Node node, mlc::printer::PrinterConfig cfg, Func write);
+Str ToPythonModule(UList items, mlc::printer::PrinterConfig cfg, int32_t num_threads);
 UDict BuildInfo();
 
 Str TensorToBytes(const TensorObj *src);
+void TensorToBytesChunked(const TensorObj *src, int64_t chunk_size, Func write);
 Str TensorToBase64(const TensorObj *src);
 Tensor TensorFromBytes(AnyView any);
 Tensor TensorFromBase64(AnyView any);
+Tensor TensorEmpty(UList shape, DLDataType dtype, DLDevice device);
+UDict TensorPoolStats();
+void TensorPoolRelease();
 
 struct DSOLibrary {
   ~DSOLibrary() { Unload(); }
@@ -646,22 +654,48 @@ inline TypeTable *TypeTable::New() {
   self->SetFunc("mlc.base.DeviceTypeRegister",
                 Func([self](const char *name) { return self->DeviceTypeRegister(name); }).get());
   self->SetFunc("mlc.core.JSONLoads", Func(::mlc::registry::JSONLoads).get());
-  self->SetFunc("mlc.core.JSONSerialize", Func(::mlc::registry::JSONSerialize).get());
+  self->SetFunc("mlc.core.JSONSerialize",
+                Func([](AnyView source) { return ::mlc::registry::JSONSerialize(source, false); }).get());
+  self->SetFunc("mlc.core.JSONSerializeWithOptions", Func(::mlc::registry::JSONSerialize).get());
   self->SetFunc("mlc.core.JSONDeserialize", Func(::mlc::registry::JSONDeserialize).get());
-  self->SetFunc("mlc.core.StructuralEqual", Func(::mlc::registry::StructuralEqual).get());
-  self->SetFunc("mlc.core.StructuralHash", Func(::mlc::registry::StructuralHash).get());
-  self->SetFunc("mlc.core.StructuralEqualFailReason", Func(::mlc::registry::StructuralEqualFailReason).get());
+  self->SetFunc("mlc.core.StructuralEqual", Func([](AnyView lhs, AnyView rhs, bool bind_free_vars, bool assert_mode) {
+                  return ::mlc::registry::StructuralEqual(lhs, rhs, bind_free_vars, assert_mode, false);
+                }).get());
+  self->SetFunc("mlc.core.StructuralHash",
+                Func([](AnyView root) { return ::mlc::registry::StructuralHash(root, false); }).get());
+  self->SetFunc("mlc.core.StructuralEqualFailReason", Func([](AnyView lhs, AnyView rhs, bool bind_free_vars) {
+                  return ::mlc::registry::StructuralEqualFailReason(lhs, rhs, bind_free_vars, false);
+                }).get());
+  self->SetFunc("mlc.core.StructuralEqualWithTensorContent", Func(::mlc::registry::StructuralEqual).get());
+  self->SetFunc("mlc.core.StructuralHashWithTensorContent", Func(::mlc::registry::StructuralHash).get());
+  self->SetFunc("mlc.core.StructuralEqualFailReasonWithTensorContent",
+                Func(::mlc::registry::StructuralEqualFailReason).get());
+  self->SetFunc("mlc.core.StructuralDiff", Func(::mlc::registry::StructuralDiff).get());
+  self->SetFunc("mlc.core.ObjectPathIntern", Func(::mlc::registry::ObjectPathIntern).get());
   self->SetFunc("mlc.core.CopyShallow", Func(::mlc::registry::CopyShallow).get());
-  self->SetFunc("mlc.core.CopyDeep", Func(::mlc::registry::CopyDeep).get());
+  self->SetFunc("mlc.core.CopyDeep",
+                Func([](AnyView root) { return ::mlc::registry::CopyDeep(root, false, 1); }).get());
+  self->SetFunc("mlc.core.CopyDeepWithOptions", Func(::mlc::registry::CopyDeep).get());
   self->SetFunc("mlc.core.CopyReplace", Func(::mlc::registry::CopyReplace).get());
   self->SetFunc("mlc.core.BuildInfo", Func(::mlc::registry::BuildInfo).get());
+  self->SetFunc("mlc.core.TracebackSetEnabled",
+                Func([](bool enabled) -> bool { return ::MLCTracebackSetEnabled(enabled) != 0; }).get());
   self->SetFunc("mlc.core.TensorToBytes", Func(::mlc::registry::TensorToBytes).get());
+  self->SetFunc("mlc.core.TensorToBytesChunked", Func(::mlc::registry::TensorToBytesChunked).get());
   self->SetFunc("mlc.core.TensorFromBytes", Func(::mlc::registry::TensorFromBytes).get());
   self->SetFunc("mlc.core.TensorToBase64", Func(::mlc::registry::TensorToBase64).get());
   self->SetFunc("mlc.core.TensorFromBase64", Func(::mlc::registry::TensorFromBase64).get());
+  self->SetFunc("mlc.core.TensorEmpty", Func(::mlc::registry::TensorEmpty).get());
+  self->SetFunc("mlc.core.TensorPoolStats", Func(::mlc::registry::TensorPoolStats).get());
+  self->SetFunc("mlc.core.TensorPoolRelease", Func(::mlc::registry::TensorPoolRelease).get());
   self->SetFunc("mlc.core.TensorToDLPack", Func([](TensorObj *tensor) -> void * { return tensor->DLPack(); }).get());
+  self->SetFunc("mlc.core.TensorToDLPackVersioned",
+                Func([](TensorObj *tensor) -> void * { return tensor->DLPackVersioned(); }).get());
   self->SetFunc("mlc.printer.DocToPythonScript", Func(::mlc::registry::DocToPythonScript).get());
+  self->SetFunc("mlc.printer.DocToPythonScriptStream", Func(::mlc::registry::DocToPythonScriptStream).get());
   self->SetFunc("mlc.printer.ToPython", Func(::mlc::printer::ToPython).get());
+  self->SetFunc("mlc.printer.ToPythonStream", Func(::mlc::printer::ToPythonStream).get());
+  self->SetFunc("mlc.printer.ToPythonModule", Func(::mlc::registry::ToPythonModule).get());
 
   MLC_TYPE_TABLE_INIT_TYPE_BEGIN(std::nullptr_t, self);
   method_member("__str__", &TypeTraits<std::nullptr_t>::__str__);
@@ -1,3 +1,7 @@
+#include "./base64.h"
+#include "./tensor_pool.h"
+#include "./thread_pool.h"
+#include "./xxhash.h"
 #include <algorithm>
 #include <cmath>
 #include <cstdint>
@@ -7,7 +11,10 @@
 #include <iostream>
 #include <memory>
 #include <mlc/core/all.h>
+#include <mutex>
+#include <optional>
 #include <ostream>
+#include <shared_mutex>
 #include <sstream>
 #include <stdexcept>
 #include <unordered_map>
@@ -17,8 +24,10 @@ namespace {
 
 using mlc::core::ObjectPath;
 using mlc::core::TopoVisit;
+using mlc::core::TopoVisitLevels;
 using mlc::core::VisitFields;
 using mlc::core::VisitStructure;
+using mlc::registry::ThreadPool;
 
 /****************** JSON ******************/
 
@@ -274,55 +283,13 @@ inline Any JSONLoads(const char *json_str, int64_t json_str_len) {
 
 /****************** Base64 Encoding/Decoding ******************/
 
-static const char kBase64EncTable[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
-static const std::array<uint8_t, 256> kBase64DecTable = []() {
-  std::array<uint8_t, 256> ret;
-  for (int i = 0; i < 256; ++i) {
-    ret[i] = 0xFF;
-  }
-  // Fill valid mappings: 'A'-'Z', 'a'-'z', '0'-'9', '+' and '/'
-  for (int i = 0; i < 64; ++i) {
-    ret[kBase64EncTable[i]] = static_cast<uint8_t>(i);
-  }
-  return ret;
-}();
-
 Str Base64Encode(const uint8_t *data, int64_t len) {
-  constexpr int BITS_PER_CHAR = 6;
-  Str ret(::mlc::core::StrPad::Allocator::NewWithPad<uint8_t>(((len + 2) / 3) * 4 + 1, 0));
+  int64_t out_len = ::mlc::registry::base64::EncodedSize(len);
+  Str ret(::mlc::core::StrPad::Allocator::NewWithPad<uint8_t>(out_len + 1, 0));
   uint8_t *out = reinterpret_cast<uint8_t *>(ret.get()->::MLCStr::data);
-  int64_t &out_len = ret.get()->::MLCStr::length;
-  for (int64_t i = 0; i < len; i += 3) {
-    // Collect up to 3 bytes into a 24-bit chunk
-    uint32_t chunk = 0;
-    int bytes_in_chunk = 0;
-    for (int j = 0; j < 3; ++j) {
-      if (i + j < len) {
-        chunk <<= 8;
-        chunk |= data[i + j];
-        bytes_in_chunk++;
-      } else {
-        chunk <<= 8; // pad with zero
-      }
-    }
-    // chunk now has up to 24 bits of actual data, left-aligned
-    // We emit 4 Base64 chars, but some might become '=' padding
-    // Based on how many raw bytes we actually had.
-    for (int k = 0; k < 4; ++k) {
-      // For each 6-bit group: (from left to right in chunk)
-      int shift = 18 - (k * BITS_PER_CHAR);
-      uint32_t index = (chunk >> shift) & 0x3F;
-      // For 3 raw bytes, k goes 0..3 => all real
-      // For 2 raw bytes, k goes 0..2 => 3rd is '='
-      // For 1 raw byte, k goes 0..1 => 2nd/3rd are '='
-      if (k <= bytes_in_chunk) {
-        out[out_len++] = kBase64EncTable[index];
-      } else {
-        out[out_len++] = '=';
-      }
-    }
-  }
+  ::mlc::registry::base64::Encode(data, len, out);
   out[out_len] = '\0';
+  ret.get()->::MLCStr::length = out_len;
   return ret;
 }
 
@@ -331,85 +298,196 @@ Str Base64Decode(const uint8_t *data, int64_t len) {
     MLC_THROW(ValueError) << "Base64Decode: Input length not multiple of 4: length = " << len
                           << ", data = " << reinterpret_cast<const char *>(data);
   }
-  Str ret(::mlc::core::StrPad::Allocator::NewWithPad<uint8_t>((len / 4) * 3 + 1, 0));
+  // The vectorized decoder writes up to 8 bytes past the decoded ones
+  Str ret(::mlc::core::StrPad::Allocator::NewWithPad<uint8_t>((len / 4) * 3 + 8 + 1, 0));
   uint8_t *out = reinterpret_cast<uint8_t *>(ret.get()->::MLCStr::data);
-  int64_t &result_len = ret.get()->::MLCStr::length;
-  for (int64_t i = 0; i < len; i += 4) {
-    // Each block of 4 chars -> up to 3 bytes
-    uint32_t accum = 0;
-    int valid_chars = 0;
-    // Read 4 base64 characters
-    for (int j = 0; j < 4; ++j) {
-      if (uint8_t c = static_cast<uint8_t>(data[i + j]); c != '=') {
-        // '=' indicates padding, do not shift in any bits
-        // we still do the loop, but no accumulation
-        if (uint8_t v = kBase64DecTable[c]; v != 0xFF) {
-          accum = (accum << 6) | v;
-          valid_chars++;
-        } else {
-          MLC_THROW(ValueError) << "Base64Decode: Invalid character in input.";
-          MLC_UNREACHABLE();
-        }
-      }
-    }
-    int total_bits = valid_chars * 6;
-    accum <<= (24 - total_bits);
-    int total_bytes = total_bits / 8;
-    for (int b = 0; b < total_bytes; ++b) {
-      uint8_t byte_val = static_cast<uint8_t>((accum >> (16 - 8 * b)) & 0xFF);
-      out[result_len++] = byte_val;
-    }
+  int64_t result_len = ::mlc::registry::base64::Decode(data, len, out);
+  if (result_len < 0) {
+    MLC_THROW(ValueError) << "Base64Decode: Invalid character in input.";
   }
   out[result_len] = '\0';
+  ret.get()->::MLCStr::length = result_len;
   return ret;
 }
 
 /****************** Structural Equal ******************/
 
+// Defined in "Tensor Contents" below
+int64_t TensorContentMismatch(const TensorObj *lhs, const TensorObj *rhs, bool bitwise = false);
+uint64_t TensorContentHash(const TensorObj *tensor);
+
 struct SEqualError : public std::runtime_error {
   ObjectPath path;
   SEqualError(const char *msg, ObjectPath path) : std::runtime_error(msg), path(path) {}
 };
 
+// Why two values are not structurally equal, as reported by `StructuralEqualImpl` in `SEqualMode::kFast`
+enum class SEqualMismatch : int32_t {
+  kNone = 0,
+  kType = 1,         // types differ
+  kValue = 2,        // POD values, strings, tensor metadata or tensor contents differ
+  kSize = 3,         // lengths of lists or dicts differ, or dict keys are missing in rhs
+  kBinding = 4,      // free variables are bound inconsistently, or unbound while binding is disallowed
+  kUncomparable = 5, // `mlc.Func`, `mlc.Error` or `mlc.Opaque` is reached
+};
+
+struct SEqualResult {
+  SEqualMismatch kind = SEqualMismatch::kNone;
+  // The pair of objects whose fields or elements mismatch, or nullptr if the roots themselves mismatch
+  Object *lhs = nullptr;
+  Object *rhs = nullptr;
+};
+
+// How `StructuralEqualImpl` reacts to mismatches
+enum class SEqualMode : int32_t {
+  kFast = 0,   // stops at the first mismatch and returns it, without building any message or path
+  kReport = 1, // throws `SEqualError` at the first mismatch
+  kDiff = 2,   // records every mismatch into `SEqualDiffs`, and moves on to the next field or element
+};
+
+// Bindings between lhs and rhs nodes. They can be shared with a nested comparison, and rolled back if it fails.
+struct SEqualBindings {
+  void Bind(Object *lhs, Object *rhs) {
+    lhs_to_rhs[lhs] = rhs;
+    rhs_to_lhs[rhs] = lhs;
+    log.push_back(lhs);
+  }
+  // Undoes every binding but the first `size` ones
+  void Rollback(size_t size) {
+    for (; log.size() > size; log.pop_back()) {
+      auto it = lhs_to_rhs.find(log.back());
+      rhs_to_lhs.erase(it->second);
+      lhs_to_rhs.erase(it);
+    }
+  }
+  std::unordered_map<Object *, Object *> lhs_to_rhs;
+  std::unordered_map<Object *, Object *> rhs_to_lhs;
+  std::vector<Object *> log;
+};
+
+// Paths to a pair of nodes being compared. They only diverge below dict keys that are distinct objects, and until then
+// `rhs` is left null.
+struct SEqualPath {
+  ObjectPath lhs{::mlc::Null};
+  ObjectPath rhs{::mlc::Null};
+
+  static SEqualPath Root() { return SEqualPath{ObjectPath::Root(), ObjectPath(::mlc::Null)}; }
+  ObjectPath Rhs() const { return rhs.defined() ? rhs : lhs; }
+  SEqualPath WithField(const char *name) const {
+    return SEqualPath{lhs->WithField(name), rhs.defined() ? rhs->WithField(name) : ObjectPath(::mlc::Null)};
+  }
+  SEqualPath WithListIndex(int64_t i) const {
+    return SEqualPath{lhs->WithListIndex(i), rhs.defined() ? rhs->WithListIndex(i) : ObjectPath(::mlc::Null)};
+  }
+  SEqualPath WithDictKey(AnyView lhs_key, AnyView rhs_key) const {
+    if (rhs.defined()) {
+      return SEqualPath{lhs->WithDictKey(lhs_key), rhs->WithDictKey(rhs_key)};
+    } else if (lhs_key.type_index >= kMLCStaticObjectBegin && lhs_key.type_index != kMLCStr &&
+               lhs_key.v.v_obj != rhs_key.v.v_obj) {
+      return SEqualPath{lhs->WithDictKey(lhs_key), lhs->WithDictKey(rhs_key)};
+    }
+    return SEqualPath{lhs->WithDictKey(lhs_key), ObjectPath(::mlc::Null)};
+  }
+};
+
+struct SEqualDiff {
+  ObjectPath lhs_path;
+  ObjectPath rhs_path;
+  std::string reason;
+};
+
+struct SEqualDiffs {
+  std::vector<SEqualDiff> items;
+  int64_t max_diffs; // negative for no limit
+  // Hashes of each object on either side, as recorded by `StructuralHashImpl` in post-order. A pair of objects with the
+  // same hash is compared in `SEqualMode::kFast` first, and not diffed any further if it turns out equal.
+  std::unordered_map<Object *, uint64_t> lhs_hashes;
+  std::unordered_map<Object *, uint64_t> rhs_hashes;
+};
+
+// Canonical representatives held by a `StructuralInternTable`. They only cover objects whose subtrees have no variables
+// or binders, whose equality doesn't depend on the bindings around them. Two such objects are then equal iff they share
+// a representative, so `SEqualMode::kFast` compares them by identity rather than descending into them.
+struct SEqualCanonical {
+  // Objects of a graph being interned, which the caller keeps alive, mapped to their representatives
+  using LocalMap = std::unordered_map<Object *, Object *>;
+  // Objects mapped to themselves and their representatives. Both are held, so no address is reused while recorded.
+  using TableMap = std::unordered_map<Object *, std::pair<ObjectRef, ObjectRef>>;
+
+  Object *Find(Object *obj) const {
+    if (local != nullptr) {
+      if (auto it = local->find(obj); it != local->end()) {
+        return it->second;
+      }
+    }
+    if (table != nullptr) {
+      if (auto it = table->find(obj); it != table->end()) {
+        return const_cast<Object *>(it->second.second.get());
+      }
+    }
+    return nullptr;
+  }
+  const LocalMap *local;
+  const TableMap *table;
+};
+
 template <typename T> MLC_INLINE T *WithOffset(Object *obj, MLCTypeField *field) {
   return reinterpret_cast<T *>(reinterpret_cast<char *>(obj) + field->offset);
 }
 
-#define MLC_CORE_EQ_S_ERR(LHS, RHS, PATH)                                                                              \
+// Only `SEqualMode::kFast` never builds paths. It only records the kind of a mismatch, while other modes hand over a
+// message and the path to `State::Report`.
+#define MLC_CORE_EQ_S_PATH(PATH) (kMode != SEqualMode::kFast ? (PATH) : SEqualPath{})
+#define MLC_CORE_EQ_S_FAIL(Kind, MSG, PATH)                                                                            \
   {                                                                                                                    \
-    std::ostringstream err;                                                                                            \
-    err << (LHS) << " vs " << (RHS);                                                                                   \
-    throw SEqualError(err.str().c_str(), (PATH));                                                                      \
+    if constexpr (kMode == SEqualMode::kFast) {                                                                        \
+      state->Fail(SEqualMismatch::Kind);                                                                               \
+    } else {                                                                                                           \
+      std::ostringstream err;                                                                                          \
+      err << MSG;                                                                                                      \
+      state->Report(err.str(), (PATH));                                                                                \
+    }                                                                                                                  \
+    return;                                                                                                            \
   }
+#define MLC_CORE_EQ_S_ERR(Kind, LHS, RHS, PATH) MLC_CORE_EQ_S_FAIL(Kind, (LHS) << " vs " << (RHS), PATH)
 #define MLC_CORE_EQ_S_ANY(Cond, Type, EQ, LHS, RHS, PATH)                                                              \
   if (Cond) {                                                                                                          \
-    Type lhs_value = LHS->operator Type();                                                                             \
-    Type rhs_value = RHS->operator Type();                                                                             \
+    Type lhs_value = static_cast<Type>(*LHS);                                                                          \
+    Type rhs_value = static_cast<Type>(*RHS);                                                                          \
     if (EQ(lhs_value, rhs_value)) {                                                                                    \
       return;                                                                                                          \
     } else {                                                                                                           \
-      MLC_CORE_EQ_S_ERR(*lhs, *rhs, PATH);                                                                             \
+      MLC_CORE_EQ_S_ERR(kValue, *lhs, *rhs, PATH);                                                                     \
     }                                                                                                                  \
   }
 #define MLC_CORE_EQ_S_OPT(Type, EQ)                                                                                    \
   MLC_INLINE void operator()(MLCTypeField *field, StructureFieldKind, Optional<Type> *_lhs) {                          \
+    if (Skip()) {                                                                                                      \
+      return;                                                                                                          \
+    }                                                                                                                  \
     const Type *lhs = _lhs->get();                                                                                     \
     const Type *rhs = WithOffset<Optional<Type>>(obj_rhs, field)->get();                                               \
     if ((lhs != nullptr || rhs != nullptr) && (lhs == nullptr || rhs == nullptr || !EQ(*lhs, *rhs))) {                 \
       AnyView LHS = lhs ? AnyView(*lhs) : AnyView(nullptr);                                                            \
       AnyView RHS = rhs ? AnyView(*rhs) : AnyView(nullptr);                                                            \
-      MLC_CORE_EQ_S_ERR(LHS, RHS, path->WithField(field->name));                                                       \
+      MLC_CORE_EQ_S_ERR(kValue, LHS, RHS, path.WithField(field->name));                                                \
     }                                                                                                                  \
   }
 #define MLC_CORE_EQ_S_POD(Type, EQ)                                                                                    \
   MLC_INLINE void operator()(MLCTypeField *field, StructureFieldKind, Type *lhs) {                                     \
+    if (Skip()) {                                                                                                      \
+      return;                                                                                                          \
+    }                                                                                                                  \
     const Type *rhs = WithOffset<Type>(obj_rhs, field);                                                                \
     if (!EQ(*lhs, *rhs)) {                                                                                             \
-      MLC_CORE_EQ_S_ERR(AnyView(*lhs), AnyView(*rhs), path->WithField(field->name));                                   \
+      MLC_CORE_EQ_S_ERR(kValue, AnyView(*lhs), AnyView(*rhs), path.WithField(field->name));                            \
     }                                                                                                                  \
   }
 
-inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
+template <SEqualMode kMode>
+inline SEqualResult StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars, bool tensor_content,
+                                        SEqualBindings *bindings = nullptr, SEqualDiffs *diffs = nullptr,
+                                        const SEqualCanonical *canonical = nullptr) {
   using CharArray = const char *;
   using VoidPtr = ::mlc::base::VoidPtr;
   using mlc::base::DeviceEqual;
@@ -420,9 +498,79 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
     MLCTypeInfo *type_info;
     bool visited;
     bool bind_free_vars; // `map_free_vars` in TVM
-    ObjectPath path;
+    SEqualPath path;
     std::unique_ptr<std::ostringstream> err;
   };
+  struct State {
+    void Fail(SEqualMismatch kind) { result = SEqualResult{kind, cur_lhs, cur_rhs}; }
+    void Report(std::string reason, const SEqualPath &path) {
+      if constexpr (kMode == SEqualMode::kReport) {
+        throw SEqualError(reason.c_str(), path.lhs);
+      } else {
+        diffs->items.push_back(SEqualDiff{path.lhs, path.Rhs(), std::move(reason)});
+      }
+    }
+    // Whether no more mismatches are wanted
+    bool Done() const {
+      if constexpr (kMode == SEqualMode::kFast) {
+        return result.kind != SEqualMismatch::kNone;
+      } else if constexpr (kMode == SEqualMode::kDiff) {
+        return diffs->max_diffs >= 0 && static_cast<int64_t>(diffs->items.size()) >= diffs->max_diffs;
+      } else {
+        return false;
+      }
+    }
+    // Whether `lhs` and `rhs` hash the same and are equal, in which case there is nothing to diff beneath them. Checked
+    // before the paths to them are built, which would otherwise dominate the cost on nearly identical graphs. In
+    // `SEqualMode::kFast`, whether they are settled by `canonical` instead, either as equal or as a mismatch.
+    bool KnownEqual(const Any *lhs, const Any *rhs, bool bind_free_vars) {
+      if constexpr (kMode != SEqualMode::kReport) {
+        if (lhs->type_index >= kMLCStaticObjectBegin && rhs->type_index >= kMLCStaticObjectBegin) {
+          return KnownEqual(static_cast<Object *>(*lhs), static_cast<Object *>(*rhs), bind_free_vars);
+        }
+      }
+      return false;
+    }
+    bool KnownEqual(Object *lhs, Object *rhs, bool bind_free_vars) {
+      if constexpr (kMode == SEqualMode::kFast) {
+        if (canonical == nullptr) {
+          return false;
+        }
+        Object *lhs_canonical = canonical->Find(lhs);
+        Object *rhs_canonical = lhs_canonical ? canonical->Find(rhs) : nullptr;
+        if (lhs_canonical == nullptr || rhs_canonical == nullptr) {
+          return false;
+        }
+        if (lhs_canonical != rhs_canonical) {
+          Fail(SEqualMismatch::kValue);
+        }
+        return true;
+      }
+      if constexpr (kMode != SEqualMode::kDiff) {
+        return false;
+      }
+      auto lhs_it = diffs->lhs_hashes.find(lhs);
+      auto rhs_it = diffs->rhs_hashes.find(rhs);
+      if (lhs_it == diffs->lhs_hashes.end() || rhs_it == diffs->rhs_hashes.end() || lhs_it->second != rhs_it->second) {
+        return false;
+      }
+      size_t num_bindings = bindings->log.size();
+      if (StructuralEqualImpl<SEqualMode::kFast>(lhs, rhs, bind_free_vars, tensor_content, bindings).kind ==
+          SEqualMismatch::kNone) {
+        return true;
+      }
+      bindings->Rollback(num_bindings);
+      return false;
+    }
+    std::vector<Task> tasks;
+    SEqualBindings *bindings;
+    SEqualDiffs *diffs;
+    const SEqualCanonical *canonical;
+    bool tensor_content;
+    Object *cur_lhs = nullptr;
+    Object *cur_rhs = nullptr;
+    SEqualResult result;
+  };
   struct Visitor {
     static bool CharArrayEqual(CharArray lhs, CharArray rhs) { return std::strcmp(lhs, rhs) == 0; }
     static bool FloatEqual(float lhs, float rhs) { return std::abs(lhs - rhs) < 1e-6; }
@@ -445,9 +593,15 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
     MLC_CORE_EQ_S_POD(VoidPtr, std::equal_to<const void *>());
     MLC_CORE_EQ_S_POD(CharArray, CharArrayEqual);
     MLC_INLINE void operator()(MLCTypeField *field, StructureFieldKind field_kind, const Any *lhs) {
+      if (Skip()) {
+        return;
+      }
       const Any *rhs = WithOffset<Any>(obj_rhs, field);
       bool bind_free_vars = this->obj_bind_free_vars || field_kind == StructureFieldKind::kBind;
-      EnqueueAny(tasks, bind_free_vars, lhs, rhs, path->WithField(field->name));
+      if (state->KnownEqual(lhs, rhs, bind_free_vars)) {
+        return;
+      }
+      EnqueueAny(state, bind_free_vars, lhs, rhs, MLC_CORE_EQ_S_PATH(path.WithField(field->name)));
     }
     MLC_INLINE void operator()(MLCTypeField *field, StructureFieldKind field_kind, ObjectRef *_lhs) {
       HandleObject(field, field_kind, _lhs->get(), WithOffset<ObjectRef>(obj_rhs, field)->get());
@@ -456,39 +610,71 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
       HandleObject(field, field_kind, _lhs->get(), WithOffset<Optional<ObjectRef>>(obj_rhs, field)->get());
     }
     inline void HandleObject(MLCTypeField *field, StructureFieldKind field_kind, Object *lhs, Object *rhs) {
-      if (lhs || rhs) {
+      if ((lhs || rhs) && !Skip()) {
         bool bind_free_vars = this->obj_bind_free_vars || field_kind == StructureFieldKind::kBind;
-        EnqueueTask(tasks, bind_free_vars, lhs, rhs, path->WithField(field->name));
+        if (lhs && rhs && state->KnownEqual(lhs, rhs, bind_free_vars)) {
+          return;
+        }
+        EnqueueTask(state, bind_free_vars, lhs, rhs, MLC_CORE_EQ_S_PATH(path.WithField(field->name)));
       }
     }
-    static void CheckShapeEqual(const int64_t *lhs, const int64_t *rhs, int32_t ndim, const ObjectPath &path) {
+    // Once enough mismatches are found, the remaining fields of the object are not compared
+    MLC_INLINE bool Skip() const { return state->Done(); }
+    static void CheckShapeEqual(State *state, const int64_t *lhs, const int64_t *rhs, int32_t ndim,
+                                const SEqualPath &path) {
       for (int32_t i = 0; i < ndim; ++i) {
         if (lhs[i] != rhs[i]) {
-          UList lhs_list{lhs, lhs + ndim};
-          UList rhs_list{rhs, rhs + ndim};
-          MLC_CORE_EQ_S_ERR(lhs_list, rhs_list, path->WithField("shape"));
+          MLC_CORE_EQ_S_ERR(kValue, UList(lhs, lhs + ndim), UList(rhs, rhs + ndim), path.WithField("shape"));
         }
       }
     }
-    static void CheckStridesEqual(const int64_t *lhs, const int64_t *rhs, int32_t ndim, const ObjectPath &path) {
+    static void CheckStridesEqual(State *state, const int64_t *lhs, const int64_t *rhs, int32_t ndim,
+                                  const SEqualPath &path) {
       if ((lhs == nullptr) != (rhs == nullptr)) {
         Any lhs_list = lhs ? Any(UList(lhs, lhs + ndim)) : Any();
         Any rhs_list = rhs ? Any(UList(rhs, rhs + ndim)) : Any();
-        MLC_CORE_EQ_S_ERR(lhs_list, rhs_list, path->WithField("strides"));
+        MLC_CORE_EQ_S_ERR(kValue, lhs_list, rhs_list, path.WithField("strides"));
+      }
+      if (lhs == nullptr) {
+        return;
       }
       for (int32_t i = 0; i < ndim; ++i) {
         if (lhs[i] != rhs[i]) {
-          UList lhs_list{lhs, lhs + ndim};
-          UList rhs_list{rhs, rhs + ndim};
-          MLC_CORE_EQ_S_ERR(lhs_list, rhs_list, path->WithField("strides"));
+          MLC_CORE_EQ_S_ERR(kValue, UList(lhs, lhs + ndim), UList(rhs, rhs + ndim), path.WithField("strides"));
         }
       }
     }
-    static void EnqueueAny(std::vector<Task> *tasks, bool bind_free_vars, const Any *lhs, const Any *rhs,
-                           ObjectPath new_path) {
+    static void CheckTypedListEqual(State *state, const TypedListObj *lhs, const TypedListObj *rhs,
+                                    const SEqualPath &path) {
+      if (!DType::Equal(lhs->dtype, rhs->dtype)) {
+        MLC_CORE_EQ_S_ERR(kValue, AnyView(lhs->dtype), AnyView(rhs->dtype), path.WithField("dtype"));
+      }
+      if (lhs->size != rhs->size) {
+        MLC_CORE_EQ_S_FAIL(kSize, "List length mismatch: " << lhs->size << " vs " << rhs->size, path);
+      }
+      int64_t i = 0;
+      if (lhs->Is<double>()) {
+        const double *lhs_data = lhs->DataAs<double>();
+        const double *rhs_data = rhs->DataAs<double>();
+        for (; i < lhs->size && DoubleEqual(lhs_data[i], rhs_data[i]); ++i) {
+        }
+      } else if (std::memcmp(lhs->data, rhs->data, lhs->NumBytes()) == 0) {
+        i = lhs->size;
+      } else {
+        const uint8_t *lhs_data = static_cast<const uint8_t *>(lhs->data);
+        const uint8_t *rhs_data = static_cast<const uint8_t *>(rhs->data);
+        int32_t elem_size = lhs->ElemSize();
+        for (; i < lhs->size && std::memcmp(lhs_data + i * elem_size, rhs_data + i * elem_size, elem_size) == 0; ++i) {
+        }
+      }
+      if (i < lhs->size) {
+        MLC_CORE_EQ_S_ERR(kValue, lhs->At(i), rhs->At(i), path.WithListIndex(i));
+      }
+    }
+    static void EnqueueAny(State *state, bool bind_free_vars, const Any *lhs, const Any *rhs, SEqualPath new_path) {
       int32_t type_index = lhs->GetTypeIndex();
       if (type_index != rhs->GetTypeIndex()) {
-        MLC_CORE_EQ_S_ERR(lhs->GetTypeKey(), rhs->GetTypeKey(), new_path);
+        MLC_CORE_EQ_S_ERR(kType, lhs->GetTypeKey(), rhs->GetTypeKey(), new_path);
       }
       if (type_index == kMLCNone) {
         return;
@@ -503,60 +689,85 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
       if (type_index < kMLCStaticObjectBegin) {
         MLC_THROW(InternalError) << "Unknown type key: " << lhs->GetTypeKey();
       }
-      EnqueueTask(tasks, bind_free_vars, lhs->operator Object *(), rhs->operator Object *(), new_path);
+      EnqueueTask(state, bind_free_vars, static_cast<Object *>(*lhs), static_cast<Object *>(*rhs), new_path);
     }
-    static void EnqueueTask(std::vector<Task> *tasks, bool bind_free_vars, Object *lhs, Object *rhs,
-                            ObjectPath new_path) {
+    static void EnqueueTask(State *state, bool bind_free_vars, Object *lhs, Object *rhs, SEqualPath new_path) {
       int32_t lhs_type_index = lhs ? lhs->GetTypeIndex() : kMLCNone;
       int32_t rhs_type_index = rhs ? rhs->GetTypeIndex() : kMLCNone;
       if (lhs_type_index != rhs_type_index) {
-        MLC_CORE_EQ_S_ERR(Lib::GetTypeKey(lhs_type_index), Lib::GetTypeKey(rhs_type_index), new_path);
+        MLC_CORE_EQ_S_ERR(kType, Lib::GetTypeKey(lhs_type_index), Lib::GetTypeKey(rhs_type_index), new_path);
       } else if (lhs_type_index == kMLCStr) {
-        Str lhs_str(reinterpret_cast<StrObj *>(lhs));
-        Str rhs_str(reinterpret_cast<StrObj *>(rhs));
-        if (lhs_str != rhs_str) {
-          MLC_CORE_EQ_S_ERR(lhs_str, rhs_str, new_path);
+        StrObj *lhs_str = reinterpret_cast<StrObj *>(lhs);
+        StrObj *rhs_str = reinterpret_cast<StrObj *>(rhs);
+        if (lhs_str->size() != rhs_str->size() || std::memcmp(lhs_str->data(), rhs_str->data(), lhs_str->size()) != 0) {
+          MLC_CORE_EQ_S_ERR(kValue, Str(lhs_str), Str(rhs_str), new_path);
         }
       } else if (lhs_type_index == kMLCTensor) {
         DLTensor *lhs_tensor = &lhs->DynCast<TensorObj>()->tensor;
         DLTensor *rhs_tensor = &rhs->DynCast<TensorObj>()->tensor;
         int32_t ndim = lhs_tensor->ndim;
         if (ndim != rhs_tensor->ndim) {
-          MLC_CORE_EQ_S_ERR(lhs_tensor->ndim, rhs_tensor->ndim, new_path->WithField("ndim"));
+          MLC_CORE_EQ_S_ERR(kValue, lhs_tensor->ndim, rhs_tensor->ndim, new_path.WithField("ndim"));
         }
-        if (lhs_tensor->byte_offset != rhs_tensor->byte_offset) {
-          MLC_CORE_EQ_S_ERR(lhs_tensor->byte_offset, rhs_tensor->byte_offset, new_path->WithField("byte_offset"));
+        if (!state->tensor_content && lhs_tensor->byte_offset != rhs_tensor->byte_offset) {
+          MLC_CORE_EQ_S_ERR(kValue, lhs_tensor->byte_offset, rhs_tensor->byte_offset,
+                            new_path.WithField("byte_offset"));
         }
         if (!::mlc::base::DType::Equal(lhs_tensor->dtype, rhs_tensor->dtype)) {
-          MLC_CORE_EQ_S_ERR(AnyView(lhs_tensor->dtype), AnyView(rhs_tensor->dtype), new_path->WithField("dtype"));
+          MLC_CORE_EQ_S_ERR(kValue, AnyView(lhs_tensor->dtype), AnyView(rhs_tensor->dtype),
+                            new_path.WithField("dtype"));
         }
         if (!::mlc::base::DeviceEqual(lhs_tensor->device, rhs_tensor->device)) {
-          MLC_CORE_EQ_S_ERR(AnyView(lhs_tensor->device), AnyView(rhs_tensor->device), new_path->WithField("device"));
+          MLC_CORE_EQ_S_ERR(kValue, AnyView(lhs_tensor->device), AnyView(rhs_tensor->device),
+                            new_path.WithField("device"));
         }
-        CheckShapeEqual(lhs_tensor->shape, rhs_tensor->shape, ndim, new_path);
-        CheckStridesEqual(lhs_tensor->strides, rhs_tensor->strides, ndim, new_path);
+        CheckShapeEqual(state, lhs_tensor->shape, rhs_tensor->shape, ndim, new_path);
+        if (!state->tensor_content) {
+          CheckStridesEqual(state, lhs_tensor->strides, rhs_tensor->strides, ndim, new_path);
+        } else if (int64_t i = TensorContentMismatch(lhs->DynCast<TensorObj>(), rhs->DynCast<TensorObj>()); i >= 0) {
+          MLC_CORE_EQ_S_FAIL(kValue, "Tensor data mismatch at element " << i, new_path.WithField("data"));
+        }
+      } else if (lhs_type_index == kMLCTypedList) {
+        CheckTypedListEqual(state, reinterpret_cast<const TypedListObj *>(lhs),
+                            reinterpret_cast<const TypedListObj *>(rhs), new_path);
       } else if (lhs_type_index == kMLCFunc || lhs_type_index == kMLCError) {
-        throw SEqualError("Cannot compare `mlc.Func` or `mlc.Error`", new_path);
+        MLC_CORE_EQ_S_FAIL(kUncomparable, "Cannot compare `mlc.Func` or `mlc.Error`", new_path);
       } else if (lhs_type_index == kMLCOpaque) {
-        std::ostringstream err;
-        err << "Cannot compare `mlc.Opaque` of type: " << lhs->DynCast<OpaqueObj>()->opaque_type_name;
-        throw SEqualError(err.str().c_str(), new_path);
+        MLC_CORE_EQ_S_FAIL(kUncomparable,
+                           "Cannot compare `mlc.Opaque` of type: " << lhs->DynCast<OpaqueObj>()->opaque_type_name,
+                           new_path);
       } else {
         bool visited = false;
         MLCTypeInfo *type_info = Lib::GetTypeInfo(lhs_type_index);
-        tasks->push_back(Task{lhs, rhs, type_info, visited, bind_free_vars, new_path, nullptr});
+        state->tasks.push_back(Task{lhs, rhs, type_info, visited, bind_free_vars, std::move(new_path), nullptr});
       }
     }
     Object *obj_rhs;
-    std::vector<Task> *tasks;
+    State *state;
     bool obj_bind_free_vars;
-    ObjectPath path;
+    SEqualPath path;
   };
-  std::vector<Task> tasks;
-  std::unordered_map<Object *, Object *> eq_lhs_to_rhs;
-  std::unordered_map<Object *, Object *> eq_rhs_to_lhs;
-
-  auto check_bind = [&eq_lhs_to_rhs, &eq_rhs_to_lhs](Object *lhs, Object *rhs, const ObjectPath &path) -> bool {
+  enum class BindState { kUnbound, kBound, kInconsistent };
+  SEqualBindings local_bindings;
+  State state;
+  state.bindings = bindings ? bindings : &local_bindings;
+  state.diffs = diffs;
+  state.canonical = canonical;
+  state.tensor_content = tensor_content;
+  std::vector<Task> &tasks = state.tasks;
+  std::unordered_map<Object *, Object *> &eq_lhs_to_rhs = state.bindings->lhs_to_rhs;
+  std::unordered_map<Object *, Object *> &eq_rhs_to_lhs = state.bindings->rhs_to_lhs;
+
+  auto fail_bind = [&](const char *msg, const SEqualPath &path) {
+    if constexpr (kMode == SEqualMode::kFast) {
+      (void)msg;
+      (void)path;
+      state.Fail(SEqualMismatch::kBinding);
+    } else {
+      state.Report(msg, path);
+    }
+  };
+  auto check_bind = [&](Object *lhs, Object *rhs, const SEqualPath &path) -> BindState {
     // check binding consistency: lhs -> rhs, rhs -> lhs
     auto it_lhs_to_rhs = eq_lhs_to_rhs.find(lhs);
     auto it_rhs_to_lhs = eq_rhs_to_lhs.find(rhs);
@@ -565,44 +776,56 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
     // already proven equal
     if (exist_lhs_to_rhs && exist_rhs_to_lhs) {
       if (it_lhs_to_rhs->second == rhs && it_rhs_to_lhs->second == lhs) {
-        return true;
+        return BindState::kBound;
       }
-      throw SEqualError("Inconsistent binding: LHS and RHS are both bound, but to different nodes", path);
+      fail_bind("Inconsistent binding: LHS and RHS are both bound, but to different nodes", path);
+      return BindState::kInconsistent;
     }
     // inconsistent binding
     if (exist_lhs_to_rhs) {
-      throw SEqualError("Inconsistent binding. LHS has been bound to a different node while RHS is not bound", path);
+      fail_bind("Inconsistent binding. LHS has been bound to a different node while RHS is not bound", path);
+      return BindState::kInconsistent;
     }
     if (exist_rhs_to_lhs) {
-      throw SEqualError("Inconsistent binding. RHS has been bound to a different node while LHS is not bound", path);
+      fail_bind("Inconsistent binding. RHS has been bound to a different node while LHS is not bound", path);
+      return BindState::kInconsistent;
     }
-    return false;
+    return BindState::kUnbound;
   };
 
-  Visitor::EnqueueTask(&tasks, bind_free_vars, lhs, rhs, ObjectPath::Root());
-  while (!tasks.empty()) {
+  if (lhs && rhs && state.KnownEqual(lhs, rhs, bind_free_vars)) {
+    return state.result;
+  }
+  Visitor::EnqueueTask(&state, bind_free_vars, lhs, rhs, MLC_CORE_EQ_S_PATH(SEqualPath::Root()));
+  while (!tasks.empty() && !state.Done()) {
     MLCTypeInfo *type_info;
-    ObjectPath path{::mlc::Null};
+    SEqualPath path;
     {
       Task &task = tasks.back();
       type_info = task.type_info;
       path = task.path;
-      lhs = task.lhs;
-      rhs = task.rhs;
+      state.cur_lhs = lhs = task.lhs;
+      state.cur_rhs = rhs = task.rhs;
       bind_free_vars = task.bind_free_vars;
       if (task.err) {
-        throw SEqualError(task.err->str().c_str(), path);
-      } else if (check_bind(lhs, rhs, path)) {
+        if constexpr (kMode == SEqualMode::kDiff) {
+          // The elements are diffed by now, so the mismatch in size is reported after them, as in `kReport`
+          state.Report(task.err->str(), path);
+          task.err.reset();
+        } else {
+          throw SEqualError(task.err->str().c_str(), path.lhs);
+        }
+      }
+      if (check_bind(lhs, rhs, path) != BindState::kUnbound) {
         tasks.pop_back();
         continue;
       } else if (task.visited) {
         StructureKind kind = static_cast<StructureKind>(type_info->structure_kind);
         if (kind == StructureKind::kBind || (kind == StructureKind::kVar && bind_free_vars)) {
           // bind lhs <-> rhs
-          eq_lhs_to_rhs[lhs] = rhs;
-          eq_rhs_to_lhs[rhs] = lhs;
+          state.bindings->Bind(lhs, rhs);
         } else if (kind == StructureKind::kVar && !bind_free_vars) {
-          throw SEqualError("Unbound variable", path);
+          fail_bind("Unbound variable", path);
         }
         tasks.pop_back();
         continue;
@@ -616,8 +839,19 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
       UListObj *rhs_list = reinterpret_cast<UListObj *>(rhs);
       int64_t lhs_size = lhs_list->size();
       int64_t rhs_size = rhs_list->size();
-      for (int64_t i = (lhs_size < rhs_size ? lhs_size : rhs_size) - 1; i >= 0; --i) {
-        Visitor::EnqueueAny(&tasks, bind_free_vars, &lhs_list->at(i), &rhs_list->at(i), path->WithListIndex(i));
+      if constexpr (kMode == SEqualMode::kFast) {
+        // No need to defer the error until the elements are checked, as there is no message to rank them by
+        if (lhs_size != rhs_size) {
+          state.Fail(SEqualMismatch::kSize);
+          break;
+        }
+      }
+      for (int64_t i = (lhs_size < rhs_size ? lhs_size : rhs_size) - 1; i >= 0 && !state.Done(); --i) {
+        if (state.KnownEqual(&lhs_list->at(i), &rhs_list->at(i), bind_free_vars)) {
+          continue;
+        }
+        Visitor::EnqueueAny(&state, bind_free_vars, &lhs_list->at(i), &rhs_list->at(i),
+                            MLC_CORE_EQ_S_PATH(path.WithListIndex(i)));
       }
       if (lhs_size != rhs_size) {
         auto &err = tasks[task_index].err = std::make_unique<std::ostringstream>();
@@ -626,6 +860,12 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
     } else if (type_info->type_index == kMLCDict) {
       UDictObj *lhs_dict = reinterpret_cast<UDictObj *>(lhs);
       UDictObj *rhs_dict = reinterpret_cast<UDictObj *>(rhs);
+      if constexpr (kMode == SEqualMode::kFast) {
+        if (lhs_dict->size() != rhs_dict->size()) {
+          state.Fail(SEqualMismatch::kSize);
+          break;
+        }
+      }
       std::vector<AnyView> not_found_lhs_keys;
       for (auto &kv : *lhs_dict) {
         AnyView lhs_key = kv.first;
@@ -633,7 +873,7 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
         UDictObj::iterator rhs_it;
         if (type_index < kMLCStaticObjectBegin || type_index == kMLCStr) {
           rhs_it = rhs_dict->find(lhs_key);
-        } else if (auto it = eq_lhs_to_rhs.find(lhs_key.operator Object *()); it != eq_lhs_to_rhs.end()) {
+        } else if (auto it = eq_lhs_to_rhs.find(static_cast<Object *>(lhs_key)); it != eq_lhs_to_rhs.end()) {
           rhs_it = rhs_dict->find(it->second);
         } else {
           not_found_lhs_keys.push_back(lhs_key);
@@ -643,10 +883,24 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
           not_found_lhs_keys.push_back(lhs_key);
           continue;
         }
-        Visitor::EnqueueAny(&tasks, bind_free_vars, &kv.second, &rhs_it->second, path->WithDictKey(lhs_key));
+        if (state.KnownEqual(&kv.second, &rhs_it->second, bind_free_vars)) {
+          continue;
+        }
+        Visitor::EnqueueAny(&state, bind_free_vars, &kv.second, &rhs_it->second,
+                            MLC_CORE_EQ_S_PATH(path.WithDictKey(lhs_key, rhs_it->first)));
+        if (state.Done()) {
+          break;
+        }
+      }
+      if (state.Done()) {
+        continue;
       }
       auto &err = tasks[task_index].err;
       if (!not_found_lhs_keys.empty()) {
+        if constexpr (kMode == SEqualMode::kFast) {
+          state.Fail(SEqualMismatch::kSize);
+          break;
+        }
         err = std::make_unique<std::ostringstream>();
         (*err) << "Dict key(s) not found in rhs: " << not_found_lhs_keys[0];
         for (size_t i = 1; i < not_found_lhs_keys.size(); ++i) {
@@ -657,9 +911,10 @@ inline void StructuralEqualImpl(Object *lhs, Object *rhs, bool bind_free_vars) {
         (*err) << "Dict size mismatch: " << lhs_dict->size() << " vs " << rhs_dict->size();
       }
     } else {
-      VisitStructure(lhs, type_info, Visitor{rhs, &tasks, bind_free_vars, path});
+      VisitStructure(lhs, type_info, Visitor{rhs, &state, bind_free_vars, path});
     }
   }
+  return state.result;
 }
 
 /****************** Structural Hash ******************/
@@ -692,6 +947,7 @@ struct HashCache {
   inline static const uint64_t MLC_SYMBOL_HIDE kRawStr = Lib::GetTypeInfo(kMLCRawStr)->type_key_hash;
   inline static const uint64_t MLC_SYMBOL_HIDE kStrObj = Lib::GetTypeInfo(kMLCStr)->type_key_hash;
   inline static const uint64_t MLC_SYMBOL_HIDE kTensorObj = Lib::GetTypeInfo(kMLCTensor)->type_key_hash;
+  inline static const uint64_t MLC_SYMBOL_HIDE kTypedListObj = Lib::GetTypeInfo(kMLCTypedList)->type_key_hash;
   inline static const uint64_t MLC_SYMBOL_HIDE kBound = ::mlc::base::StrHash("$$Bounds$$");
   inline static const uint64_t MLC_SYMBOL_HIDE kUnbound = ::mlc::base::StrHash("$$Unbound$$");
 };
@@ -706,7 +962,11 @@ template <typename T> MLC_INLINE uint64_t HashTyped(uint64_t type_hash, T value)
   return ::mlc::base::HashCombine(type_hash, u.tgt);
 }
 
-inline uint64_t StructuralHashImpl(Object *obj) {
+// If `post_order` is given, each object reached is appended with its hash once its children are hashed. Binding markers
+// and ordinals are then left out, so that each recorded hash only depends on the subtree beneath its object, rather than
+// on where that subtree sits in the graph.
+inline uint64_t StructuralHashImpl(Object *obj, bool tensor_content,
+                                   std::vector<std::pair<Object *, uint64_t>> *post_order = nullptr) {
   using CharArray = const char *;
   using VoidPtr = ::mlc::base::VoidPtr;
   using mlc::base::HashCombine;
@@ -748,7 +1008,7 @@ inline uint64_t StructuralHashImpl(Object *obj) {
     MLC_CORE_HASH_S_POD(CharArray, HashCharArray);
     MLC_INLINE void operator()(MLCTypeField *, StructureFieldKind field_kind, const Any *v) {
       bool bind_free_vars = this->obj_bind_free_vars || field_kind == StructureFieldKind::kBind;
-      EnqueueAny(tasks, bind_free_vars, v);
+      EnqueueAny(tasks, bind_free_vars, tensor_content, v);
     }
     MLC_INLINE void operator()(MLCTypeField *field, StructureFieldKind field_kind, ObjectRef *_v) {
       HandleObject(field, field_kind, _v->get());
@@ -758,12 +1018,26 @@ inline uint64_t StructuralHashImpl(Object *obj) {
     }
     inline void HandleObject(MLCTypeField *, StructureFieldKind field_kind, Object *v) {
       bool bind_free_vars = this->obj_bind_free_vars || field_kind == StructureFieldKind::kBind;
-      EnqueueTask(tasks, bind_free_vars, v);
+      EnqueueTask(tasks, bind_free_vars, tensor_content, v);
+    }
+    static uint64_t HashTypedList(const TypedListObj *list) {
+      uint64_t hash_value = HashCombine(HashDataType(list->dtype), list->size);
+      if (list->Is<double>()) {
+        // Canonicalize NaNs so that the hash stays consistent with `HashDouble`
+        const double *data = list->DataAs<double>();
+        for (int64_t i = 0; i < list->size; ++i) {
+          hash_value = HashCombine(hash_value, HashTyped<double>(0, std::isnan(data[i]) ? std::numeric_limits<double>::quiet_NaN() : data[i]));
+        }
+      } else {
+        // Integers and booleans are hashed word-by-word over the contiguous buffer
+        hash_value = HashCombine(hash_value, ::mlc::base::StrHash(static_cast<const char *>(list->data), list->NumBytes()));
+      }
+      return HashTyped(HashCache::kTypedListObj, hash_value);
     }
     static void EnqueuePOD(std::vector<Task> *tasks, uint64_t hash_value) {
       tasks->emplace_back(Task{nullptr, nullptr, false, false, hash_value});
     }
-    static void EnqueueAny(std::vector<Task> *tasks, bool bind_free_vars, const Any *v) {
+    static void EnqueueAny(std::vector<Task> *tasks, bool bind_free_vars, bool tensor_content, const Any *v) {
       int32_t type_index = v->GetTypeIndex();
       MLC_CORE_HASH_S_ANY(type_index == kMLCBool, bool, HashBool);
       MLC_CORE_HASH_S_ANY(type_index == kMLCInt, int64_t, HashInteger);
@@ -772,9 +1046,9 @@ inline uint64_t StructuralHashImpl(Object *obj) {
       MLC_CORE_HASH_S_ANY(type_index == kMLCDataType, DLDataType, HashDataType);
       MLC_CORE_HASH_S_ANY(type_index == kMLCDevice, DLDevice, HashDevice);
       MLC_CORE_HASH_S_ANY(type_index == kMLCRawStr, CharArray, HashCharArray);
-      EnqueueTask(tasks, bind_free_vars, v->operator Object *());
+      EnqueueTask(tasks, bind_free_vars, tensor_content, v->operator Object *());
     }
-    static void EnqueueTask(std::vector<Task> *tasks, bool bind_free_vars, Object *obj) {
+    static void EnqueueTask(std::vector<Task> *tasks, bool bind_free_vars, bool tensor_content, Object *obj) {
       int32_t type_index = obj ? obj->GetTypeIndex() : kMLCNone;
       if (type_index == kMLCNone) {
         EnqueuePOD(tasks, HashCache::kNoneCombined);
@@ -786,19 +1060,26 @@ inline uint64_t StructuralHashImpl(Object *obj) {
       } else if (type_index == kMLCTensor) {
         const DLTensor *tensor = &reinterpret_cast<const MLCTensor *>(obj)->tensor;
         uint64_t hash_value = HashInteger(tensor->ndim);
-        hash_value = HashCombine(hash_value, HashInteger(tensor->byte_offset));
+        if (!tensor_content) {
+          hash_value = HashCombine(hash_value, HashInteger(tensor->byte_offset));
+        }
         hash_value = HashCombine(hash_value, HashDataType(tensor->dtype));
         hash_value = HashCombine(hash_value, HashDevice(tensor->device));
         for (int32_t i = 0; i < tensor->ndim; ++i) {
           hash_value = HashCombine(hash_value, HashInteger(tensor->shape[i]));
         }
-        if (tensor->strides) {
+        if (tensor_content) {
+          // Layout is not part of the contents, so only the elements are hashed, in row-major order
+          hash_value = HashCombine(hash_value, TensorContentHash(reinterpret_cast<const TensorObj *>(obj)));
+        } else if (tensor->strides) {
           for (int32_t i = 0; i < tensor->ndim; ++i) {
             hash_value = HashCombine(hash_value, HashInteger(tensor->strides[i]));
           }
         }
         hash_value = HashTyped(HashCache::kTensorObj, hash_value);
         EnqueuePOD(tasks, hash_value);
+      } else if (type_index == kMLCTypedList) {
+        EnqueuePOD(tasks, HashTypedList(reinterpret_cast<const TypedListObj *>(obj)));
       } else if (type_index == kMLCFunc || type_index == kMLCError) {
         throw SEqualError("Cannot compare `mlc.Func` or `mlc.Error`", ObjectPath::Root());
       } else if (type_index == kMLCOpaque) {
@@ -813,13 +1094,14 @@ inline uint64_t StructuralHashImpl(Object *obj) {
 
     std::vector<Task> *tasks;
     bool obj_bind_free_vars;
+    bool tensor_content;
   };
   std::vector<Task> tasks;
   std::vector<uint64_t> result_hashes;
   std::unordered_map<Object *, uint64_t> obj2hash;
   int64_t num_bound_nodes = 0;
   int64_t num_unbound_vars = 0;
-  Visitor::EnqueueTask(&tasks, false, obj);
+  Visitor::EnqueueTask(&tasks, false, tensor_content, obj);
   while (!tasks.empty()) {
     MLCTypeInfo *type_info;
     bool bind_free_vars;
@@ -840,7 +1122,9 @@ inline uint64_t StructuralHashImpl(Object *obj) {
           hash_value = HashCombine(hash_value, result_hashes.back());
         }
         StructureKind kind = static_cast<StructureKind>(type_info->structure_kind);
-        if (kind == StructureKind::kBind || (kind == StructureKind::kVar && bind_free_vars)) {
+        if (post_order != nullptr) {
+          post_order->emplace_back(obj, hash_value);
+        } else if (kind == StructureKind::kBind || (kind == StructureKind::kVar && bind_free_vars)) {
           hash_value = HashCombine(hash_value, HashCache::kBound);
           hash_value = HashCombine(hash_value, num_bound_nodes++);
         } else if (kind == StructureKind::kVar && !bind_free_vars) {
@@ -868,7 +1152,7 @@ inline uint64_t StructuralHashImpl(Object *obj) {
       UListObj *list = reinterpret_cast<UListObj *>(obj);
       hash_value = HashCombine(hash_value, list->size());
       for (int64_t i = list->size() - 1; i >= 0; --i) {
-        Visitor::EnqueueAny(&tasks, bind_free_vars, &list->at(i));
+        Visitor::EnqueueAny(&tasks, bind_free_vars, tensor_content, &list->at(i));
       }
     } else if (type_info->type_index == kMLCDict) {
       UDictObj *dict = reinterpret_cast<UDictObj *>(obj);
@@ -901,10 +1185,10 @@ inline uint64_t StructuralHashImpl(Object *obj) {
           hash = HashTyped(HashCache::kStrObj, hash);
         } else if (k.type_index >= kMLCStaticObjectBegin) {
           obj = k;
-          if (auto it = obj2hash.find(obj); it != obj2hash.end()) {
+          if (auto it = obj2hash.find(obj); it != obj2hash.end() && post_order == nullptr) {
             hash = it->second;
           } else {
-            continue; // Skip unbound nodes
+            continue; // Skip unbound nodes, and with `post_order`, all object keys as they depend on visiting order
           }
         }
         kv_pairs.push_back(KVPair{hash, k, v});
@@ -919,12 +1203,13 @@ inline uint64_t StructuralHashImpl(Object *obj) {
         if (i + 1 == j) {
           Any k = kv_pairs[i].key;
           Any v = kv_pairs[i].value;
-          Visitor::EnqueueAny(&tasks, bind_free_vars, &k);
-          Visitor::EnqueueAny(&tasks, bind_free_vars, &v);
+          Visitor::EnqueueAny(&tasks, bind_free_vars, tensor_content, &k);
+          Visitor::EnqueueAny(&tasks, bind_free_vars, tensor_content, &v);
         }
+        i = j;
       }
     } else {
-      VisitStructure(obj, type_info, Visitor{&tasks, bind_free_vars});
+      VisitStructure(obj, type_info, Visitor{&tasks, bind_free_vars, tensor_content});
     }
   }
   if (result_hashes.size() != 1) {
@@ -942,6 +1227,138 @@ inline uint64_t StructuralHashImpl(Object *obj) {
 #undef MLC_CORE_HASH_S_POD
 #undef MLC_CORE_HASH_S_ANY
 
+/****************** Fast Construction ******************/
+
+// Types defined in Python via `py_class` are allocated by `AllocExternObject`, and their memory layout is fully
+// described by the reflected fields. Such objects can be built by writing fields in place, skipping the FFI round trip
+// into their Python `__init__`, which only assigns the same fields one by one.
+struct FieldwiseInit {
+  static std::optional<FieldwiseInit> For(MLCTypeInfo *type_info, FuncObj *init_func) {
+    if (type_info->type_index < kMLCDynObjectBegin || init_func == nullptr || !init_func->IsForeign()) {
+      return std::nullopt;
+    }
+    int64_t num_bytes = sizeof(MLCAny);
+    int32_t num_fields = 0;
+    for (MLCTypeField *field = type_info->fields; field->name != nullptr; ++field, ++num_fields) {
+      int32_t ty = field->ty->type_index;
+      if (ty == kMLCTypingPtr || field->offset < static_cast<int64_t>(sizeof(MLCAny)) ||
+          (ty == kMLCTypingAtomic && reinterpret_cast<MLCTypingAtomic *>(field->ty)->type_index == kMLCRawStr)) {
+        return std::nullopt;
+      }
+      num_bytes = std::max(num_bytes, field->offset + field->num_bytes);
+    }
+    num_bytes = (num_bytes + 7) / 8 * 8;
+    FuncObj *post_init = Lib::_post_init(type_info->type_index);
+    return FieldwiseInit{type_info, static_cast<int32_t>(num_bytes), num_fields, post_init};
+  }
+
+  // Whether `value` can be stored into `field` without the conversion or validation done by a field setter
+  static bool AcceptsAsIs(MLCTypeField *field, AnyView value) {
+    MLCAny *ty = field->ty;
+    if (ty->type_index == kMLCTypingAny) {
+      return true;
+    }
+    if (ty->type_index == kMLCTypingOptional) {
+      if (value.type_index == kMLCNone) {
+        return true;
+      }
+      ty = reinterpret_cast<MLCTypingOptional *>(ty)->ty.ptr;
+    }
+    if (ty->type_index != kMLCTypingAtomic) {
+      return false; // e.g. `List[T]` and `Dict[K, V]` need their elements checked
+    }
+    int32_t expected = reinterpret_cast<MLCTypingAtomic *>(ty)->type_index;
+    if (expected < kMLCStaticObjectBegin) {
+      return value.type_index == expected || (expected == kMLCFloat && value.type_index == kMLCInt);
+    }
+    if (value.type_index < kMLCStaticObjectBegin) {
+      return false;
+    }
+    if (value.type_index == expected) {
+      return true;
+    }
+    MLCTypeInfo *value_info = Lib::GetTypeInfo(value.type_index);
+    MLCTypeInfo *expected_info = Lib::GetTypeInfo(expected);
+    return value_info != nullptr && expected_info != nullptr && expected_info->type_depth < value_info->type_depth &&
+           value_info->type_ancestors[expected_info->type_depth] == expected;
+  }
+
+  // Whether `args` can be written by `operator()` with the same outcome as the field setters. POD fields are converted
+  // with checks anyway, but values of the other fields are stored without checking their type
+  bool AcceptsAsIs(int32_t num_args, const AnyView *args) const {
+    if (num_args != this->num_fields) {
+      return false;
+    }
+    int32_t i = 0;
+    for (MLCTypeField *field = this->type_info->fields; field->name != nullptr; ++field, ++i) {
+      MLCAny *ty = field->ty;
+      if (ty->type_index == kMLCTypingOptional) {
+        ty = reinterpret_cast<MLCTypingOptional *>(ty)->ty.ptr;
+      }
+      bool is_pod = ty->type_index == kMLCTypingAtomic &&
+                    reinterpret_cast<MLCTypingAtomic *>(ty)->type_index < kMLCStaticObjectBegin;
+      if (!is_pod && !AcceptsAsIs(field, args[i])) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool IsForeign() const { return this->post_init != nullptr && this->post_init->IsForeign(); }
+
+  Any operator()(int32_t num_args, const AnyView *args) const {
+    struct Writer {
+      MLC_INLINE void operator()(MLCTypeField *, Any *v) { *v = Next(); }
+      MLC_INLINE void operator()(MLCTypeField *, ObjectRef *v) {
+        AnyView arg = Next();
+        if (arg.type_index != kMLCNone) {
+          *v = arg.operator ObjectRef();
+        }
+      }
+      MLC_INLINE void operator()(MLCTypeField *, Optional<ObjectRef> *v) { *v = Next().operator Optional<ObjectRef>(); }
+      MLC_INLINE void operator()(MLCTypeField *, Optional<bool> *v) { *v = Next().operator Optional<bool>(); }
+      MLC_INLINE void operator()(MLCTypeField *, Optional<int64_t> *v) { *v = Next().operator Optional<int64_t>(); }
+      MLC_INLINE void operator()(MLCTypeField *, Optional<double> *v) { *v = Next().operator Optional<double>(); }
+      MLC_INLINE void operator()(MLCTypeField *, Optional<DLDevice> *v) { *v = Next().operator Optional<DLDevice>(); }
+      MLC_INLINE void operator()(MLCTypeField *, Optional<DLDataType> *v) {
+        *v = Next().operator Optional<DLDataType>();
+      }
+      MLC_INLINE void operator()(MLCTypeField *, Optional<void *> *v) { *v = Next().operator Optional<void *>(); }
+      MLC_INLINE void operator()(MLCTypeField *, bool *v) { *v = Next().operator bool(); }
+      MLC_INLINE void operator()(MLCTypeField *, int8_t *v) { *v = static_cast<int8_t>(Next().operator int64_t()); }
+      MLC_INLINE void operator()(MLCTypeField *, int16_t *v) { *v = static_cast<int16_t>(Next().operator int64_t()); }
+      MLC_INLINE void operator()(MLCTypeField *, int32_t *v) { *v = static_cast<int32_t>(Next().operator int64_t()); }
+      MLC_INLINE void operator()(MLCTypeField *, int64_t *v) { *v = Next().operator int64_t(); }
+      MLC_INLINE void operator()(MLCTypeField *, float *v) { *v = static_cast<float>(Next().operator double()); }
+      MLC_INLINE void operator()(MLCTypeField *, double *v) { *v = Next().operator double(); }
+      MLC_INLINE void operator()(MLCTypeField *, DLDataType *v) { *v = Next().operator DLDataType(); }
+      MLC_INLINE void operator()(MLCTypeField *, DLDevice *v) { *v = Next().operator DLDevice(); }
+      MLC_INLINE void operator()(MLCTypeField *, void **v) { *v = Next().operator void *(); }
+      MLC_INLINE void operator()(MLCTypeField *, const char **) { MLC_UNREACHABLE(); }
+      MLC_INLINE AnyView Next() { return args[i++]; }
+      const AnyView *args;
+      int32_t i;
+    };
+    if (num_args != this->num_fields) {
+      MLC_THROW(TypeError) << "Mismatched number of arguments when constructing `" << this->type_info->type_key
+                           << "`. Expected " << this->num_fields << " but got " << num_args << " arguments";
+    }
+    // Zero-initialized memory is a valid empty state for every field, so a partially written object is safely
+    // released by `ExternObjDeleter` if any conversion below throws
+    Any ret = ::mlc::AllocExternObject(this->type_info->type_index, this->num_bytes);
+    VisitFields(ret.operator Object *(), this->type_info, Writer{args, 0});
+    if (this->post_init != nullptr) {
+      (*this->post_init)(ret);
+    }
+    return ret;
+  }
+
+  MLCTypeInfo *type_info;
+  int32_t num_bytes;
+  int32_t num_fields;
+  FuncObj *post_init;
+};
+
 /****************** Copy ******************/
 
 inline Any CopyShallowImpl(AnyView source) {
@@ -952,6 +1369,8 @@ inline Any CopyShallowImpl(AnyView source) {
     return UList(list->begin(), list->end());
   } else if (UDictObj *dict = source.as<UDictObj>()) {
     return UDict(dict->begin(), dict->end());
+  } else if (TypedListObj *list = source.as<TypedListObj>()) {
+    return TypedList(list->dtype, list->size, list->data);
   } else if (source.IsInstance<StrObj>() || source.IsInstance<ErrorObj>() || source.IsInstance<FuncObj>() ||
              source.IsInstance<TensorObj>()) {
     // TODO: do we want to shallow copy these types at all?
@@ -998,40 +1417,43 @@ inline void CopyReplaceImpl(int32_t num_args, const AnyView *args, Any *ret) {
   if (::mlc::base::IsTypeIndexPOD(type_index)) {
     MLC_THROW(TypeError) << "TypeError: `__replace__` doesn't work on a POD type: " << source;
   } else if (source.IsInstance<StrObj>() || source.IsInstance<ErrorObj>() || source.IsInstance<FuncObj>() ||
-             source.IsInstance<UListObj>() || source.IsInstance<UDictObj>() || source.IsInstance<TensorObj>()) {
+             source.IsInstance<UListObj>() || source.IsInstance<UDictObj>() || source.IsInstance<TensorObj>() ||
+             source.IsInstance<TypedListObj>()) {
     MLC_THROW(TypeError) << "TypeError: `__replace__` doesn't work on type: " << source.GetTypeKey();
   }
   struct Copier {
-    MLC_INLINE void operator()(MLCTypeField *f, const Any *any) { AddField(f->name, AnyView(*any)); }
-    MLC_INLINE void operator()(MLCTypeField *f, ObjectRef *obj) { AddField(f->name, AnyView(*obj)); }
-    MLC_INLINE void operator()(MLCTypeField *f, Optional<ObjectRef> *opt) { AddField(f->name, AnyView(*opt)); }
-    MLC_INLINE void operator()(MLCTypeField *f, Optional<bool> *opt) { AddField(f->name, AnyView(*opt)); }
-    MLC_INLINE void operator()(MLCTypeField *f, Optional<int64_t> *opt) { AddField(f->name, AnyView(*opt)); }
-    MLC_INLINE void operator()(MLCTypeField *f, Optional<double> *opt) { AddField(f->name, AnyView(*opt)); }
-    MLC_INLINE void operator()(MLCTypeField *f, Optional<DLDevice> *opt) { AddField(f->name, AnyView(*opt)); }
-    MLC_INLINE void operator()(MLCTypeField *f, Optional<DLDataType> *opt) { AddField(f->name, AnyView(*opt)); }
-    MLC_INLINE void operator()(MLCTypeField *f, bool *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, int8_t *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, int16_t *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, int32_t *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, int64_t *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, float *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, double *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, DLDataType *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, DLDevice *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, Optional<void *> *v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, void **v) { AddField(f->name, AnyView(*v)); }
-    MLC_INLINE void operator()(MLCTypeField *f, const char **v) { AddField(f->name, AnyView(*v)); }
-
-    void AddField(std::string_view name, AnyView v) {
-      if (auto it = replacements->find(name); it != replacements->end()) {
+    MLC_INLINE void operator()(MLCTypeField *f, const Any *any) { AddField(f, AnyView(*any)); }
+    MLC_INLINE void operator()(MLCTypeField *f, ObjectRef *obj) { AddField(f, AnyView(*obj)); }
+    MLC_INLINE void operator()(MLCTypeField *f, Optional<ObjectRef> *opt) { AddField(f, AnyView(*opt)); }
+    MLC_INLINE void operator()(MLCTypeField *f, Optional<bool> *opt) { AddField(f, AnyView(*opt)); }
+    MLC_INLINE void operator()(MLCTypeField *f, Optional<int64_t> *opt) { AddField(f, AnyView(*opt)); }
+    MLC_INLINE void operator()(MLCTypeField *f, Optional<double> *opt) { AddField(f, AnyView(*opt)); }
+    MLC_INLINE void operator()(MLCTypeField *f, Optional<DLDevice> *opt) { AddField(f, AnyView(*opt)); }
+    MLC_INLINE void operator()(MLCTypeField *f, Optional<DLDataType> *opt) { AddField(f, AnyView(*opt)); }
+    MLC_INLINE void operator()(MLCTypeField *f, bool *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, int8_t *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, int16_t *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, int32_t *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, int64_t *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, float *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, double *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, DLDataType *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, DLDevice *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, Optional<void *> *v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, void **v) { AddField(f, AnyView(*v)); }
+    MLC_INLINE void operator()(MLCTypeField *f, const char **v) { AddField(f, AnyView(*v)); }
+
+    void AddField(MLCTypeField *f, AnyView v) {
+      if (auto it = replacements->find(f->name); it != replacements->end()) {
         fields->push_back(it->second);
+        accepts_as_is = accepts_as_is && FieldwiseInit::AcceptsAsIs(f, it->second);
       } else {
         fields->push_back(v);
       }
     }
     std::vector<AnyView> *fields;
     std::unordered_map<std::string_view, AnyView> *replacements;
+    bool accepts_as_is = true;
   };
   std::unordered_map<std::string_view, AnyView> replacements;
   for (int32_t i = 1; i < num_args; i += 2) {
@@ -1041,11 +1463,29 @@ inline void CopyReplaceImpl(int32_t num_args, const AnyView *args, Any *ret) {
   FuncObj *init_func = Lib::_init(type_index);
   MLCTypeInfo *type_info = Lib::GetTypeInfo(type_index);
   std::vector<AnyView> fields;
-  VisitFields(source.operator Object *(), type_info, Copier{&fields, &replacements});
-  ::mlc::base::FuncCall(init_func, static_cast<int32_t>(fields.size()), fields.data(), ret);
+  Copier copier{&fields, &replacements};
+  VisitFields(source.operator Object *(), type_info, copier);
+  if (std::optional<FieldwiseInit> fieldwise = FieldwiseInit::For(type_info, init_func);
+      fieldwise.has_value() && copier.accepts_as_is) {
+    *ret = (*fieldwise)(static_cast<int32_t>(fields.size()), fields.data());
+  } else {
+    ::mlc::base::FuncCall(init_func, static_cast<int32_t>(fields.size()), fields.data(), ret);
+  }
+}
+
+inline bool IsFrozenType(MLCTypeInfo *type_info) {
+  if (static_cast<StructureKind>(type_info->structure_kind) == StructureKind::kVar) {
+    return false;
+  }
+  for (MLCTypeField *field = type_info->fields; field && field->name != nullptr; ++field) {
+    if (!field->frozen) {
+      return false;
+    }
+  }
+  return true;
 }
 
-inline Any CopyDeepImpl(AnyView source) {
+inline Any CopyDeepImpl(AnyView source, bool share_frozen, int32_t num_threads) {
   if (::mlc::base::IsTypeIndexPOD(source.type_index)) {
     return source;
   }
@@ -1086,6 +1526,7 @@ inline Any CopyDeepImpl(AnyView source) {
     void HandleObject(const Object *obj) {
       if (auto it = orig2copy->find(obj); it != orig2copy->end()) {
         fields->push_back(AnyView(it->second));
+        all_shared = all_shared && it->second.get() == obj;
       } else {
         MLC_THROW(InternalError) << "InternalError: object doesn't exist in the memo: " << AnyView(obj);
       }
@@ -1101,41 +1542,198 @@ inline Any CopyDeepImpl(AnyView source) {
 
     std::unordered_map<const Object *, ObjectRef> *orig2copy;
     std::vector<AnyView> *fields;
+    bool all_shared = true;
+  };
+  struct TypeCopyInfo {
+    FuncObj *init_func;
+    std::optional<FieldwiseInit> fieldwise;
+    bool is_frozen;
+    bool IsForeign() const { return fieldwise.has_value() ? fieldwise->IsForeign() : init_func->IsForeign(); }
   };
   std::unordered_map<const Object *, ObjectRef> orig2copy;
-  std::vector<AnyView> fields;
-  TopoVisit(source.operator Object *(), nullptr, [&](Object *object, MLCTypeInfo *type_info) mutable -> void {
+  std::unordered_map<int32_t, TypeCopyInfo> type2info;
+  // Read-only once the dependency graph is built, so it is safe to access from multiple threads
+  auto pre_visit = [&](Object *, MLCTypeInfo *type_info) -> void {
+    int32_t type_index = type_info->type_index;
+    if (type_index == kMLCList || type_index == kMLCDict || type_index == kMLCError || type_index == kMLCFunc ||
+        type_index == kMLCStr || type_index == kMLCTensor || type_index == kMLCOpaque || type_index == kMLCTypedList) {
+      return;
+    }
+    if (type2info.count(type_index) == 0) {
+      FuncObj *init_func = Lib::_init(type_index);
+      type2info.emplace(type_index,
+                        TypeCopyInfo{init_func, FieldwiseInit::For(type_info, init_func), IsFrozenType(type_info)});
+    }
+  };
+  auto copy_object = [&](Object *object, MLCTypeInfo *type_info, std::vector<AnyView> *fields) -> Any {
     Any ret;
+    fields->clear();
     if (UListObj *list = object->as<UListObj>()) {
-      fields.clear();
-      fields.reserve(list->size());
+      fields->reserve(list->size());
       for (Any &e : *list) {
-        Copier{&orig2copy, &fields}.HandleAny(&e);
+        Copier{&orig2copy, fields}.HandleAny(&e);
       }
-      UList::FromAnyTuple(static_cast<int32_t>(fields.size()), fields.data(), &ret);
+      UList::FromAnyTuple(static_cast<int32_t>(fields->size()), fields->data(), &ret);
     } else if (UDictObj *dict = object->as<UDictObj>()) {
-      fields.clear();
       for (auto [key, value] : *dict) {
-        Copier{&orig2copy, &fields}.HandleAny(&key);
-        Copier{&orig2copy, &fields}.HandleAny(&value);
+        Copier{&orig2copy, fields}.HandleAny(&key);
+        Copier{&orig2copy, fields}.HandleAny(&value);
       }
-      UDict::FromAnyTuple(static_cast<int32_t>(fields.size()), fields.data(), &ret);
+      UDict::FromAnyTuple(static_cast<int32_t>(fields->size()), fields->data(), &ret);
+    } else if (TypedListObj *list = object->as<TypedListObj>()) {
+      ret = TypedList(list->dtype, list->size, list->data);
     } else if (object->IsInstance<StrObj>() || object->IsInstance<ErrorObj>() || object->IsInstance<FuncObj>() ||
                object->IsInstance<TensorObj>()) {
       ret = object;
     } else if (object->IsInstance<OpaqueObj>()) {
       MLC_THROW(TypeError) << "Cannot copy `mlc.Opaque` of type: " << object->DynCast<OpaqueObj>()->opaque_type_name;
     } else {
-      fields.clear();
-      VisitFields(object, type_info, Copier{&orig2copy, &fields});
-      FuncObj *init_func = Lib::_init(type_info->type_index);
-      ::mlc::base::FuncCall(init_func, static_cast<int32_t>(fields.size()), fields.data(), &ret);
+      const TypeCopyInfo &info = type2info.at(type_info->type_index);
+      Copier copier{&orig2copy, fields};
+      VisitFields(object, type_info, copier);
+      // With `share_frozen`, an object whose fields are all frozen and whose children are all shared cannot be
+      // mutated through either copy, so the copy may alias the original instead of calling `__init__` again.
+      if (share_frozen && copier.all_shared && info.is_frozen) {
+        ret = object;
+      } else if (info.fieldwise.has_value()) {
+        ret = (*info.fieldwise)(static_cast<int32_t>(fields->size()), fields->data());
+      } else {
+        ::mlc::base::FuncCall(info.init_func, static_cast<int32_t>(fields->size()), fields->data(), &ret);
+      }
     }
-    orig2copy[object] = ret.operator ObjectRef();
-  });
+    return ret;
+  };
+  if (ThreadPool::NumThreads(num_threads) == 1) {
+    std::vector<AnyView> fields;
+    TopoVisit(source.operator Object *(), pre_visit, [&](Object *object, MLCTypeInfo *type_info) -> void {
+      orig2copy[object] = copy_object(object, type_info, &fields).operator ObjectRef();
+    });
+    return orig2copy.at(source.operator Object *());
+  }
+  // Objects in the same topological level are constructed concurrently. Constructors defined in a foreign language
+  // (e.g. Python) are called from the current thread instead, as they are serialized by the foreign runtime anyway.
+  // `py_class` objects built by `FieldwiseInit` do not call into Python and are constructed concurrently as well.
+  ThreadPool pool(num_threads);
+  std::vector<std::vector<AnyView>> fields(pool.Size());
+  std::vector<int64_t> native, foreign;
+  std::vector<Any> results;
+  TopoVisitLevels(
+      source.operator Object *(), pre_visit, [&](const std::vector<std::pair<Object *, MLCTypeInfo *>> &level) {
+        native.clear();
+        foreign.clear();
+        for (int64_t i = 0; i < static_cast<int64_t>(level.size()); ++i) {
+          auto it = type2info.find(level[i].second->type_index);
+          if (it != type2info.end() && it->second.IsForeign()) {
+            foreign.push_back(i);
+          } else {
+            native.push_back(i);
+          }
+        }
+        results.clear();
+        results.resize(level.size());
+        pool.ParallelFor(static_cast<int64_t>(native.size()), [&](int64_t i, int32_t thread_id) {
+          auto [object, type_info] = level[native[i]];
+          results[native[i]] = copy_object(object, type_info, &fields[thread_id]);
+        });
+        for (int64_t i : foreign) {
+          results[i] = copy_object(level[i].first, level[i].second, &fields[0]);
+        }
+        for (size_t i = 0; i < level.size(); ++i) {
+          orig2copy[level[i].first] = results[i].operator ObjectRef();
+        }
+      });
   return orig2copy.at(source.operator Object *());
 }
 
+/****************** Tensor Allocation ******************/
+
+// Number of bytes of the block behind a CPU tensor from `TensorEmpty`: the payload, followed by the shape
+inline int64_t CPUTensorBlockBytes(int32_t ndim, const int64_t *shape, DLDataType dtype) {
+  int64_t num_bytes = ::mlc::core::ShapeToNumel(ndim, shape) * ::mlc::base::DType::Size(dtype);
+  return (num_bytes + 7) / 8 * 8 + (ndim + 1) * static_cast<int64_t>(sizeof(int64_t));
+}
+
+// Allocates an uninitialized compact tensor. On CPU, the payload and the shape share a single block from the memory
+// pool. On other devices, the payload is allocated by the global function `mlc.core.DeviceAlloc.<device type>` with
+// signature `(num_bytes: int, device: Device) -> Ptr`, and freed by `mlc.core.DeviceFree.<device type>` with signature
+// `(ptr: Ptr, device: Device)`.
+Tensor TensorEmpty(int32_t ndim, const int64_t *shape, DLDataType dtype, DLDevice device) {
+  using ::mlc::registry::tensor_pool::CPUMemoryPool;
+  if (ndim < 0) {
+    MLC_THROW(ValueError) << "Invalid number of dimensions: " << ndim;
+  }
+  bool is_empty = false;
+  for (int32_t i = 0; i < ndim; ++i) {
+    if (shape[i] < 0) {
+      MLC_THROW(ValueError) << "Invalid shape: dimension " << i << " has negative extent " << shape[i];
+    }
+    is_empty |= shape[i] == 0;
+  }
+  // The byte size is capped the same way as for `TypedList`, which keeps it and the block size below from overflowing
+  constexpr int64_t kMaxNumBytes = int64_t{1} << 62;
+  int64_t max_numel = kMaxNumBytes / std::max<int64_t>(::mlc::base::DType::Size(dtype), 1);
+  int64_t numel = 1;
+  for (int32_t i = 0; i < ndim && !is_empty; ++i) {
+    if (numel > max_numel / shape[i]) {
+      MLC_THROW(ValueError) << "Tensor is too large: its size exceeds " << kMaxNumBytes << " bytes at dimension " << i;
+    }
+    numel *= shape[i];
+  }
+  TensorObj *ret = ::mlc::DefaultObjectAllocator<TensorObj>::New();
+  ret->tensor.data = nullptr;
+  ret->tensor.device = device;
+  ret->tensor.ndim = ndim;
+  ret->tensor.dtype = dtype;
+  ret->tensor.shape = nullptr;
+  ret->tensor.strides = nullptr;
+  ret->tensor.byte_offset = 0;
+  ret->manager_ctx = nullptr;
+  if (device.device_type == kDLCPU) {
+    ret->_mlc_header.v.deleter = +[](void *_self) {
+      TensorObj *self = static_cast<TensorObj *>(_self);
+      if (void *block = self->tensor.data) {
+        int64_t num_bytes = CPUTensorBlockBytes(self->tensor.ndim, self->tensor.shape, self->tensor.dtype);
+        CPUMemoryPool::Global()->Free(block, num_bytes);
+      }
+      self->tensor.shape = nullptr; // owned by the block
+      ::mlc::DefaultObjectAllocator<TensorObj>::Deleter(self);
+    };
+    Tensor tensor(ret);
+    int64_t block_bytes = CPUTensorBlockBytes(ndim, shape, dtype);
+    uint8_t *block = static_cast<uint8_t *>(CPUMemoryPool::Global()->Alloc(block_bytes));
+    int64_t *block_shape = reinterpret_cast<int64_t *>(block + block_bytes) - (ndim + 1);
+    std::copy(shape, shape + ndim, block_shape);
+    block_shape[ndim] = -1;
+    ret->tensor.shape = block_shape;
+    ret->tensor.data = block;
+    return tensor;
+  }
+  std::string device_type = ::mlc::base::DeviceType2Str(device.device_type);
+  std::string alloc_name = "mlc.core.DeviceAlloc." + device_type;
+  std::string free_name = "mlc.core.DeviceFree." + device_type;
+  FuncObj *alloc_func = Lib::FuncGetGlobal(alloc_name.c_str(), /*allow_missing=*/true);
+  FuncObj *free_func = Lib::FuncGetGlobal(free_name.c_str(), /*allow_missing=*/true);
+  if (alloc_func == nullptr || free_func == nullptr) {
+    MLC_THROW(ValueError) << "Cannot allocate tensor on device `" << AnyView(device) << "`. Register functions `"
+                          << alloc_name << "` and `" << free_name << "` to enable it";
+  }
+  ret->manager_ctx = free_func; // global functions are never destroyed
+  ret->_mlc_header.v.deleter = +[](void *_self) {
+    TensorObj *self = static_cast<TensorObj *>(_self);
+    if (self->tensor.data != nullptr) {
+      (*static_cast<FuncObj *>(self->manager_ctx))(self->tensor.data, self->tensor.device);
+    }
+    ::mlc::DefaultObjectAllocator<TensorObj>::Deleter(self);
+  };
+  Tensor tensor(ret);
+  ret->tensor.shape = new int64_t[ndim + 1];
+  std::copy(shape, shape + ndim, ret->tensor.shape);
+  ret->tensor.shape[ndim] = -1;
+  int64_t num_bytes = ::mlc::core::ShapeToNumel(ndim, shape) * ::mlc::base::DType::Size(dtype);
+  ret->tensor.data = (*alloc_func)(num_bytes, device).operator void *();
+  return tensor;
+}
+
 /****************** Tensor <=> Bytes ******************/
 
 template <int N, typename T> union BytesUnion {
@@ -1174,19 +1772,6 @@ template <int N, typename T> T ReadElem(const uint8_t *data, int64_t *head, int6
   return v.v;
 }
 
-void WriteElemMany(uint8_t *data, int64_t *tail, uint8_t *ptr, int32_t elem_size, int64_t numel) {
-  uint8_t *start = data + *tail;
-  std::memcpy(start, ptr, elem_size * numel);
-  if constexpr (kIsBigEndian) {
-    if (elem_size > 1) { // we need to swap each element
-      for (int64_t i = 0; i < numel; ++i, start += elem_size) {
-        std::reverse(start, start + elem_size);
-      }
-    }
-  }
-  *tail += static_cast<int64_t>(numel * elem_size);
-}
-
 void ReadElemMany(const uint8_t *data, int64_t *head, int64_t max_size, uint8_t *ptr, int32_t elem_size,
                   int64_t numel) {
   int64_t next_head = *head + numel * elem_size;
@@ -1205,26 +1790,275 @@ void ReadElemMany(const uint8_t *data, int64_t *head, int64_t max_size, uint8_t
   }
 }
 
+void SwapElemBytes(uint8_t *data, int32_t elem_size, int64_t numel) {
+  if constexpr (kIsBigEndian) {
+    if (elem_size > 1) { // we need to swap each element
+      for (int64_t i = 0; i < numel; ++i, data += elem_size) {
+        std::reverse(data, data + elem_size);
+      }
+    }
+  }
+}
+
+// Strided view of a tensor payload in units of elements, where unit-extent dimensions are dropped and adjacent
+// dimensions that are contiguous with each other are merged
+struct TensorLayout {
+  explicit TensorLayout(const DLTensor *src)
+      : elem_size(::mlc::base::DType::Size(src->dtype)), numel(::mlc::core::ShapeToNumel(src->ndim, src->shape)) {
+    int64_t contiguous_stride = numel;
+    for (int32_t i = 0; i < src->ndim; ++i) {
+      int64_t extent = src->shape[i];
+      contiguous_stride = extent == 0 ? 0 : contiguous_stride / extent;
+      int64_t stride = src->strides ? src->strides[i] : contiguous_stride;
+      if (extent == 1) {
+        continue;
+      }
+      if (!shape.empty() && strides.back() == stride * extent) {
+        shape.back() *= extent;
+        strides.back() = stride;
+      } else {
+        shape.push_back(extent);
+        strides.push_back(stride);
+      }
+      (stride < 0 ? min_offset : max_offset) += (extent - 1) * stride;
+    }
+  }
+
+  int32_t ndim() const { return static_cast<int32_t>(shape.size()); }
+  bool IsCompact() const { return numel == 0 || shape.empty() || (shape.size() == 1 && strides[0] == 1); }
+  int64_t NumBytes() const { return numel * elem_size; }
+  // Number of bytes from the lowest to the highest addressed element, inclusively
+  int64_t SpanBytes() const { return numel == 0 ? 0 : (max_offset - min_offset + 1) * elem_size; }
+
+  int32_t elem_size;
+  int64_t numel;
+  std::vector<int64_t> shape;
+  std::vector<int64_t> strides;
+  int64_t min_offset = 0;
+  int64_t max_offset = 0;
+};
+
+// Invokes `f` with `std::integral_constant<int32_t, N>` if the element size `N` is a common one, so that per-element
+// copies compile down to a single load and store, or with `std::integral_constant<int32_t, 0>` otherwise
+template <typename F> void DispatchElemSize(int32_t elem_size, F f) {
+  switch (elem_size) {
+  case 1:
+    return f(std::integral_constant<int32_t, 1>{});
+  case 2:
+    return f(std::integral_constant<int32_t, 2>{});
+  case 4:
+    return f(std::integral_constant<int32_t, 4>{});
+  case 8:
+    return f(std::integral_constant<int32_t, 8>{});
+  default:
+    return f(std::integral_constant<int32_t, 0>{});
+  }
+}
+
+// Copies elements `[begin, end)` of `layout` in row-major order from `base` to `out`
+void GatherRange(const TensorLayout &layout, const uint8_t *base, int64_t begin, int64_t end, uint8_t *out) {
+  if (layout.IsCompact()) {
+    std::memcpy(out, base + begin * layout.elem_size, (end - begin) * layout.elem_size);
+    return;
+  }
+  const int32_t ndim = layout.ndim();
+  const int64_t row_len = layout.shape[ndim - 1];
+  const int64_t row_stride = layout.strides[ndim - 1];
+  std::vector<int64_t> index(ndim);
+  int64_t offset = 0;
+  int64_t rest = begin;
+  for (int32_t i = ndim - 1; i >= 0; --i) {
+    index[i] = rest % layout.shape[i];
+    rest /= layout.shape[i];
+    offset += index[i] * layout.strides[i];
+  }
+  DispatchElemSize(layout.elem_size, [&](auto n) {
+    constexpr int32_t N = decltype(n)::value;
+    const int64_t elem_size = N ? N : layout.elem_size;
+    for (int64_t i = begin; i < end;) {
+      int64_t count = std::min(row_len - index[ndim - 1], end - i);
+      const uint8_t *src = base + offset * elem_size;
+      if (row_stride == 1) {
+        std::memcpy(out, src, count * elem_size);
+        out += count * elem_size;
+      } else {
+        for (int64_t j = 0; j < count; ++j, out += elem_size, src += row_stride * elem_size) {
+          std::memcpy(out, src, N ? N : elem_size);
+        }
+      }
+      // Move on to the next row
+      i += count;
+      offset += count * row_stride;
+      index[ndim - 1] += count;
+      for (int32_t d = ndim - 1; d > 0 && index[d] == layout.shape[d]; --d) {
+        offset += layout.strides[d - 1] - index[d] * layout.strides[d];
+        index[d] = 0;
+        ++index[d - 1];
+      }
+    }
+  });
+}
+
+// Copies all elements of `layout` in row-major order from `base` to `out`. If the smallest stride is not on the
+// innermost dimension, copying row by row would touch a new cache line per element, so the plane spanned by these
+// two dimensions is copied in tiles that fit in L1 instead.
+void GatherAll(const TensorLayout &layout, const uint8_t *base, uint8_t *out) {
+  constexpr int64_t kTile = 32;
+  const int32_t ndim = layout.ndim();
+  const int32_t inner = ndim - 1;
+  int32_t fast = inner;
+  for (int32_t i = 0; i < inner; ++i) {
+    if (std::abs(layout.strides[i]) < std::abs(layout.strides[fast])) {
+      fast = i;
+    }
+  }
+  if (layout.IsCompact() || fast == inner) {
+    GatherRange(layout, base, 0, layout.numel, out);
+    return;
+  }
+  std::vector<int64_t> out_strides(ndim);
+  for (int32_t i = ndim - 1; i >= 0; --i) {
+    out_strides[i] = i == ndim - 1 ? 1 : out_strides[i + 1] * layout.shape[i + 1];
+  }
+  const int64_t rows = layout.shape[fast];
+  const int64_t cols = layout.shape[inner];
+  const int64_t src_row_stride = layout.strides[fast];
+  const int64_t src_col_stride = layout.strides[inner];
+  const int64_t dst_row_stride = out_strides[fast];
+  DispatchElemSize(layout.elem_size, [&](auto n) {
+    constexpr int32_t N = decltype(n)::value;
+    const int64_t elem_size = N ? N : layout.elem_size;
+    std::vector<int64_t> index(ndim, 0);
+    int64_t src_offset = 0;
+    int64_t dst_offset = 0;
+    for (;;) {
+      const uint8_t *src = base + src_offset * elem_size;
+      uint8_t *dst = out + dst_offset * elem_size;
+      for (int64_t r0 = 0; r0 < rows; r0 += kTile) {
+        int64_t r1 = std::min(r0 + kTile, rows);
+        for (int64_t c0 = 0; c0 < cols; c0 += kTile) {
+          int64_t c1 = std::min(c0 + kTile, cols);
+          for (int64_t c = c0; c < c1; ++c) {
+            for (int64_t r = r0; r < r1; ++r) {
+              std::memcpy(dst + (r * dst_row_stride + c) * elem_size,
+                          src + (r * src_row_stride + c * src_col_stride) * elem_size, N ? N : elem_size);
+            }
+          }
+        }
+      }
+      // Move on to the next plane
+      int32_t d = ndim - 1;
+      for (; d >= 0; --d) {
+        if (d == fast || d == inner) {
+          continue;
+        }
+        src_offset += layout.strides[d];
+        dst_offset += out_strides[d];
+        if (++index[d] < layout.shape[d]) {
+          break;
+        }
+        src_offset -= index[d] * layout.strides[d];
+        dst_offset -= index[d] * out_strides[d];
+        index[d] = 0;
+      }
+      if (d < 0) {
+        break;
+      }
+    }
+  });
+}
+
+inline bool IsHostAccessible(DLDevice device) {
+  return device.device_type == kDLCPU || device.device_type == kDLCUDAHost || device.device_type == kDLROCMHost;
+}
+
+// Copies `num_bytes` bytes at `src` on `device` to `dst` on host. The copy is delegated to the global function
+// `mlc.core.DeviceCopyToHost.<device type>` with signature `(dst: Ptr, src: Ptr, num_bytes: int, device: Device)`,
+// which device runtimes register without this library having to link against them.
+void DeviceCopyToHost(DLDevice device, const uint8_t *src, int64_t num_bytes, uint8_t *dst) {
+  if (num_bytes == 0) {
+    return;
+  }
+  std::string name = std::string("mlc.core.DeviceCopyToHost.") + ::mlc::base::DeviceType2Str(device.device_type);
+  FuncObj *func = Lib::FuncGetGlobal(name.c_str(), /*allow_missing=*/true);
+  if (func == nullptr) {
+    MLC_THROW(ValueError) << "Cannot copy tensor data from device `" << AnyView(device) << "` to host. Register function `"
+                          << name << "` to enable it";
+  }
+  (*func)(static_cast<void *>(dst), static_cast<void *>(const_cast<uint8_t *>(src)), num_bytes, device);
+}
+
+// Reads the payload of a tensor in row-major order and in little endian, from any device
+struct TensorPayloadReader {
+  explicit TensorPayloadReader(const DLTensor *src)
+      : device(src->device), data(static_cast<const uint8_t *>(src->data) + src->byte_offset), layout(src),
+        staging(), base(data) {
+    if (!IsHostAccessible(device)) {
+      if (layout.IsCompact()) {
+        // Compact payloads are fetched piece by piece in `Read`
+        base = nullptr;
+      } else {
+        // Strided payloads are fetched all at once, and gathered on host
+        staging.reset(new uint8_t[layout.SpanBytes()]);
+        DeviceCopyToHost(device, data + layout.min_offset * layout.elem_size, layout.SpanBytes(), staging.get());
+        base = staging.get() - layout.min_offset * layout.elem_size;
+      }
+    }
+  }
+
+  // Whether elements can be viewed in place, i.e. without copying or byte swapping
+  bool IsDirect() const { return base != nullptr && layout.IsCompact() && !kIsBigEndian; }
+
+  // Returns elements `[begin, end)`, either in place or copied to `buffer`
+  const uint8_t *View(int64_t begin, int64_t end, uint8_t *buffer) const {
+    if (this->IsDirect()) {
+      return base + begin * layout.elem_size;
+    }
+    this->Read(begin, end, buffer);
+    return buffer;
+  }
+
+  // Writes elements `[begin, end)` to `out`
+  void Read(int64_t begin, int64_t end, uint8_t *out) const {
+    if (base == nullptr) {
+      DeviceCopyToHost(device, data + begin * layout.elem_size, (end - begin) * layout.elem_size, out);
+    } else if (begin == 0 && end == layout.numel) {
+      GatherAll(layout, base, out);
+    } else {
+      GatherRange(layout, base, begin, end, out);
+    }
+    SwapElemBytes(out, layout.elem_size, end - begin);
+  }
+
+  DLDevice device;
+  const uint8_t *data;
+  TensorLayout layout;
+  std::unique_ptr<uint8_t[]> staging;
+  const uint8_t *base;
+};
+
 static const uint64_t kMLCTensorMagic = 0xDD5E40F096B4A13F;
 
-Str TensorToBytes(const DLTensor *src) {
-  if (src->device.device_type != kDLCPU || src->strides != nullptr) {
-    MLC_THROW(ValueError) << "SaveDLPack: Only CPU tensor without strides is supported.";
+inline int64_t TensorHeaderSize(int32_t ndim) { return 8 + 4 + 4 + 8 * static_cast<int64_t>(ndim); }
+
+void WriteTensorHeader(const DLTensor *src, uint8_t *data_ptr, int64_t *tail) {
+  WriteElem<8>(data_ptr, tail, static_cast<uint64_t>(kMLCTensorMagic));
+  WriteElem<4>(data_ptr, tail, static_cast<uint32_t>(src->ndim));
+  WriteElem<4>(data_ptr, tail, src->dtype);
+  for (int i = 0; i < src->ndim; ++i) {
+    WriteElem<8>(data_ptr, tail, src->shape[i]);
   }
-  int32_t ndim = src->ndim;
-  int64_t numel = ::mlc::core::ShapeToNumel(ndim, src->shape);
-  int32_t elem_size = ::mlc::base::DType::Size(src->dtype);
-  int64_t total_bytes = 8 + 4 + 4 + 8 * ndim + numel * elem_size;
+}
+
+Str TensorToBytes(const DLTensor *src) {
+  TensorPayloadReader reader(src);
+  int64_t total_bytes = TensorHeaderSize(src->ndim) + reader.layout.NumBytes();
   Str ret(::mlc::core::StrPad::Allocator::NewWithPad<uint8_t>(total_bytes + 1, total_bytes));
   uint8_t *data_ptr = reinterpret_cast<uint8_t *>(ret->data());
   int64_t tail = 0;
-  WriteElem<8>(data_ptr, &tail, static_cast<uint64_t>(kMLCTensorMagic));
-  WriteElem<4>(data_ptr, &tail, static_cast<uint32_t>(ndim));
-  WriteElem<4>(data_ptr, &tail, src->dtype);
-  for (int i = 0; i < ndim; ++i) {
-    WriteElem<8>(data_ptr, &tail, src->shape[i]);
-  }
-  WriteElemMany(data_ptr, &tail, static_cast<uint8_t *>(src->data), elem_size, numel);
+  WriteTensorHeader(src, data_ptr, &tail);
+  reader.Read(0, reader.layout.numel, data_ptr + tail);
+  tail += reader.layout.NumBytes();
   data_ptr[tail] = '\0';
   if (tail != total_bytes) {
     MLC_THROW(InternalError) << "SaveDLPack: Internal error in serialization.";
@@ -1232,6 +2066,57 @@ Str TensorToBytes(const DLTensor *src) {
   return ret;
 }
 
+// Produces the same bytes as `TensorToBytes`, but hands them to `emit` in pieces of exactly `chunk_size` bytes
+// (except for the last one) without materializing the whole payload
+void TensorToBytesChunked(const DLTensor *src, int64_t chunk_size,
+                          const std::function<void(const uint8_t *data, int64_t size)> &emit) {
+  if (chunk_size <= 0) {
+    MLC_THROW(ValueError) << "TensorToBytesChunked: `chunk_size` must be positive, but got: " << chunk_size;
+  }
+  TensorPayloadReader reader(src);
+  const int32_t elem_size = reader.layout.elem_size;
+  const int64_t numel = reader.layout.numel;
+  std::unique_ptr<uint8_t[]> chunk(new uint8_t[chunk_size]);
+  int64_t filled = 0;
+  auto put = [&](const uint8_t *data, int64_t size) {
+    while (size > 0) {
+      int64_t n = std::min(size, chunk_size - filled);
+      std::memcpy(chunk.get() + filled, data, n);
+      data += n;
+      size -= n;
+      if ((filled += n) == chunk_size) {
+        emit(chunk.get(), chunk_size);
+        filled = 0;
+      }
+    }
+  };
+  {
+    std::vector<uint8_t> header(TensorHeaderSize(src->ndim));
+    int64_t tail = 0;
+    WriteTensorHeader(src, header.data(), &tail);
+    put(header.data(), tail);
+  }
+  std::vector<uint8_t> elem(elem_size);
+  for (int64_t i = 0; i < numel;) {
+    if (int64_t count = std::min((chunk_size - filled) / elem_size, numel - i); count > 0) {
+      reader.Read(i, i + count, chunk.get() + filled);
+      i += count;
+      if ((filled += count * elem_size) == chunk_size) {
+        emit(chunk.get(), chunk_size);
+        filled = 0;
+      }
+    } else {
+      // An element straddles two chunks
+      reader.Read(i, i + 1, elem.data());
+      put(elem.data(), elem_size);
+      i += 1;
+    }
+  }
+  if (filled > 0) {
+    emit(chunk.get(), filled);
+  }
+}
+
 Tensor TensorFromBytes(const uint8_t *data_ptr, int64_t max_size) {
   int64_t head = 0;
   uint64_t header = ReadElem<8, uint64_t>(data_ptr, &head, max_size);
@@ -1239,41 +2124,155 @@ Tensor TensorFromBytes(const uint8_t *data_ptr, int64_t max_size) {
     MLC_THROW(ValueError) << "LoadDLPack: Magic number mismatch.";
   }
   int32_t ndim = ReadElem<4, int32_t>(data_ptr, &head, max_size);
-  Tensor ret = [ndim]() {
-    TensorObj *ret = ::mlc::DefaultObjectAllocator<TensorObj>::New();
-    ret->tensor.data = nullptr;
-    ret->tensor.device = DLDevice{kDLCPU, 0};
-    ret->tensor.ndim = ndim;
-    ret->tensor.dtype = DLDataType{kDLFloat, 32, 1};
-    ret->tensor.shape = new int64_t[ndim + 1];
-    ret->tensor.strides = nullptr;
-    ret->tensor.byte_offset = 0;
-    ret->manager_ctx = nullptr;
-    ret->_mlc_header.v.deleter = +[](void *_self) {
-      TensorObj *self = static_cast<TensorObj *>(_self);
-      uint8_t *data = static_cast<uint8_t *>(self->tensor.data);
-      delete[] data;
-      ::mlc::DefaultObjectAllocator<TensorObj>::Deleter(self);
-    };
-    return Tensor(ret);
-  }();
-  DLTensor *tensor = &ret->tensor;
-  tensor->dtype = ReadElem<4, DLDataType>(data_ptr, &head, max_size);
+  DLDataType dtype = ReadElem<4, DLDataType>(data_ptr, &head, max_size);
+  std::vector<int64_t> shape;
   for (int32_t i = 0; i < ndim; ++i) {
-    tensor->shape[i] = ReadElem<8, int64_t>(data_ptr, &head, max_size);
-  }
-  tensor->shape[ndim] = -1;
-  int32_t elem_size = ::mlc::base::DType::Size(tensor->dtype);
-  int64_t numel = ::mlc::core::ShapeToNumel(ndim, tensor->shape);
-  uint8_t *content = new uint8_t[numel * elem_size];
-  ReadElemMany(data_ptr, &head, max_size, content, elem_size, numel);
-  tensor->data = content;
+    shape.push_back(ReadElem<8, int64_t>(data_ptr, &head, max_size));
+  }
+  Tensor ret = TensorEmpty(ndim, shape.data(), dtype, DLDevice{kDLCPU, 0});
+  int32_t elem_size = ::mlc::base::DType::Size(dtype);
+  int64_t numel = ::mlc::core::ShapeToNumel(ndim, shape.data());
+  ReadElemMany(data_ptr, &head, max_size, static_cast<uint8_t *>(ret->tensor.data), elem_size, numel);
   return ret;
 }
 
+/****************** Tensor Contents ******************/
+
+// Number of elements per step when comparing or hashing payloads that cannot be viewed in place
+inline int64_t ContentChunkNumel(const TensorPayloadReader &reader) {
+  constexpr int64_t kChunkBytes = 1 << 20;
+  return reader.IsDirect() ? std::max<int64_t>(reader.layout.numel, 1)
+                           : std::max<int64_t>(kChunkBytes / reader.layout.elem_size, 1);
+}
+
+template <typename T> int64_t FloatMismatch(const uint8_t *lhs, const uint8_t *rhs, int64_t numel, T tolerance) {
+  for (int64_t i = 0; i < numel; ++i) {
+    BytesUnion<sizeof(T), T> a, b;
+    std::memcpy(a.b, lhs + i * sizeof(T), sizeof(T));
+    std::memcpy(b.b, rhs + i * sizeof(T), sizeof(T));
+    if constexpr (kIsBigEndian) {
+      std::reverse(a.b, a.b + sizeof(T));
+      std::reverse(b.b, b.b + sizeof(T));
+    }
+    if (!(a.v == b.v || std::abs(a.v - b.v) < tolerance || (std::isnan(a.v) && std::isnan(b.v)))) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Returns the index of the first element, in row-major order, that differs between two tensors of the same dtype and
+// shape, or -1 if there is none. Unless `bitwise` is set, elements of `float32` and `float64` are compared with the same
+// tolerance as `float` and `double` fields, and all others bitwise.
+int64_t TensorContentMismatch(const TensorObj *lhs, const TensorObj *rhs, bool bitwise) {
+  const DLTensor *a = &lhs->tensor;
+  const DLTensor *b = &rhs->tensor;
+  const int32_t ndim = a->ndim;
+  if (a->data == b->data && a->byte_offset == b->byte_offset &&
+      ((a->strides == nullptr && b->strides == nullptr) ||
+       (a->strides != nullptr && b->strides != nullptr && std::equal(a->strides, a->strides + ndim, b->strides)))) {
+    return -1;
+  }
+  const DLDataType dtype = a->dtype;
+  const bool is_float32 = !bitwise && dtype.code == kDLFloat && dtype.bits == 32 && dtype.lanes == 1;
+  const bool is_float64 = !bitwise && dtype.code == kDLFloat && dtype.bits == 64 && dtype.lanes == 1;
+  TensorPayloadReader lhs_reader(a);
+  TensorPayloadReader rhs_reader(b);
+  const int64_t numel = lhs_reader.layout.numel;
+  const int32_t elem_size = lhs_reader.layout.elem_size;
+  const int64_t step = std::min(ContentChunkNumel(lhs_reader), ContentChunkNumel(rhs_reader));
+  std::unique_ptr<uint8_t[]> lhs_buffer(lhs_reader.IsDirect() ? nullptr : new uint8_t[step * elem_size]);
+  std::unique_ptr<uint8_t[]> rhs_buffer(rhs_reader.IsDirect() ? nullptr : new uint8_t[step * elem_size]);
+  for (int64_t begin = 0; begin < numel; begin += step) {
+    int64_t end = std::min(begin + step, numel);
+    const uint8_t *lhs_data = lhs_reader.View(begin, end, lhs_buffer.get());
+    const uint8_t *rhs_data = rhs_reader.View(begin, end, rhs_buffer.get());
+    if (std::memcmp(lhs_data, rhs_data, (end - begin) * elem_size) == 0) {
+      continue;
+    }
+    int64_t i = -1;
+    if (is_float32) {
+      i = FloatMismatch<float>(lhs_data, rhs_data, end - begin, 1e-6f);
+    } else if (is_float64) {
+      i = FloatMismatch<double>(lhs_data, rhs_data, end - begin, 1e-8);
+    } else {
+      for (i = 0; std::memcmp(lhs_data + i * elem_size, rhs_data + i * elem_size, elem_size) == 0; ++i) {
+      }
+    }
+    if (i >= 0) {
+      return begin + i;
+    }
+  }
+  return -1;
+}
+
+// Returns the XXH64 of the payload in row-major order and in little endian. It is not memoized: any payload can be
+// written in place, e.g. through DLPack or the raw `data` pointer.
+uint64_t TensorContentHash(const TensorObj *tensor) {
+  TensorPayloadReader reader(&tensor->tensor);
+  const int64_t numel = reader.layout.numel;
+  const int32_t elem_size = reader.layout.elem_size;
+  const int64_t step = ContentChunkNumel(reader);
+  std::unique_ptr<uint8_t[]> buffer(reader.IsDirect() ? nullptr : new uint8_t[step * elem_size]);
+  ::mlc::registry::xxhash::XXH64 state;
+  for (int64_t begin = 0; begin < numel; begin += step) {
+    int64_t end = std::min(begin + step, numel);
+    state.Update(reader.View(begin, end, buffer.get()), (end - begin) * elem_size);
+  }
+  return state.Digest();
+}
+
 /****************** Serialize / Deserialize ******************/
 
-inline mlc::Str Serialize(Any any) {
+// Constant pool of tensor payloads. Tensors viewing the same bytes of the same device with the same dtype and layout
+// share a payload, and so do tensors with bitwise identical contents if `dedup_content` is set.
+struct TensorPool {
+  explicit TensorPool(bool dedup_content) : dedup_content(dedup_content) {}
+
+  int32_t Add(TensorObj *tensor) {
+    const DLTensor *t = &tensor->tensor;
+    std::vector<int32_t> &same_data = by_data[static_cast<const uint8_t *>(t->data) + t->byte_offset];
+    for (int32_t i : same_data) {
+      if (SameView(t, &payloads[i]->tensor)) {
+        return i;
+      }
+    }
+    std::vector<int32_t> *same_hash = nullptr;
+    if (dedup_content) {
+      same_hash = &by_content[TensorContentHash(tensor)];
+      for (int32_t i : *same_hash) {
+        if (SameShape(t, &payloads[i]->tensor) && TensorContentMismatch(tensor, payloads[i], /*bitwise=*/true) < 0) {
+          same_data.push_back(i);
+          return i;
+        }
+      }
+    }
+    int32_t ret = static_cast<int32_t>(payloads.size());
+    payloads.push_back(tensor);
+    same_data.push_back(ret);
+    if (same_hash) {
+      same_hash->push_back(ret);
+    }
+    return ret;
+  }
+
+  static bool SameShape(const DLTensor *a, const DLTensor *b) {
+    return a->ndim == b->ndim && ::mlc::base::DType::Equal(a->dtype, b->dtype) &&
+           std::equal(a->shape, a->shape + a->ndim, b->shape);
+  }
+
+  static bool SameView(const DLTensor *a, const DLTensor *b) {
+    return ::mlc::base::DeviceEqual(a->device, b->device) && SameShape(a, b) &&
+           TensorLayout(a).strides == TensorLayout(b).strides;
+  }
+
+  bool dedup_content;
+  std::vector<TensorObj *> payloads;
+  std::unordered_map<const uint8_t *, std::vector<int32_t>> by_data;
+  std::unordered_map<uint64_t, std::vector<int32_t>> by_content;
+};
+
+inline mlc::Str Serialize(Any any, bool dedup_tensor_content) {
   using mlc::base::TypeTraits;
   std::vector<const char *> type_keys;
   auto get_json_type_index = [type_key2index = std::unordered_map<const char *, int32_t>(),
@@ -1366,7 +2365,7 @@ inline mlc::Str Serialize(Any any) {
   };
 
   std::unordered_map<Object *, int32_t> topo_indices;
-  std::vector<TensorObj *> tensors;
+  TensorPool tensors(dedup_tensor_content);
   std::ostringstream os;
   auto on_visit = [&topo_indices, get_json_type_index = &get_json_type_index, os = &os, &tensors,
                    is_first_object = true](Object *object, MLCTypeInfo *type_info) mutable -> void {
@@ -1397,8 +2396,26 @@ inline mlc::Str Serialize(Any any) {
         emitter(nullptr, &kv.second);
       }
     } else if (TensorObj *tensor = object->as<TensorObj>()) {
-      (*os) << ", " << tensors.size();
-      tensors.push_back(tensor);
+      (*os) << ", " << tensors.Add(tensor);
+    } else if (TypedListObj *list = object->as<TypedListObj>()) {
+      // Elements are emitted as plain JSON scalars, not as `[type_index, value]` pairs
+      (*os) << ", \"" << ::mlc::base::DType::Str(list->dtype) << '"';
+      if (list->Is<int64_t>()) {
+        const int64_t *data = list->DataAs<int64_t>();
+        for (int64_t i = 0; i < list->size; ++i) {
+          (*os) << ", " << data[i];
+        }
+      } else if (list->Is<double>()) {
+        const double *data = list->DataAs<double>();
+        for (int64_t i = 0; i < list->size; ++i) {
+          emitter.EmitFloat(data[i]);
+        }
+      } else {
+        const uint8_t *data = static_cast<const uint8_t *>(list->data);
+        for (int64_t i = 0; i < list->size; ++i) {
+          emitter.EmitBool(data[i] != 0);
+        }
+      }
     } else if (object->IsInstance<FuncObj>() || object->IsInstance<ErrorObj>()) {
       MLC_THROW(TypeError) << "Unserializable type: " << object->GetTypeKey();
     } else if (object->IsInstance<OpaqueObj>()) {
@@ -1443,13 +2460,13 @@ inline mlc::Str Serialize(Any any) {
     os << '"' << type_keys[i] << '\"';
   }
   os << "]";
-  if (!tensors.empty()) {
+  if (!tensors.payloads.empty()) {
     os << ", \"tensors\": [";
-    for (size_t i = 0; i < tensors.size(); ++i) {
+    for (size_t i = 0; i < tensors.payloads.size(); ++i) {
       if (i > 0) {
         os << ", ";
       }
-      Str b64 = tensors[i]->ToBase64();
+      Str b64 = tensors.payloads[i]->ToBase64();
       os << '"' << b64->data() << '"';
     }
     os << "]";
@@ -1460,27 +2477,41 @@ inline mlc::Str Serialize(Any any) {
 
 inline Any Deserialize(const char *json_str, int64_t json_str_len) {
   int32_t json_type_index_tensor = -1;
+  int32_t json_type_index_typed_list = -1;
   // Step 0. Parse JSON string
   UDict json_obj = JSONLoads(json_str, json_str_len);
   // Step 1. type_key => constructors
   UList type_keys = json_obj->at("type_keys");
   std::vector<FuncObj *> constructors;
+  std::vector<std::optional<FieldwiseInit>> fieldwise_constructors;
   constructors.reserve(type_keys.size());
+  fieldwise_constructors.reserve(type_keys.size());
   for (Str type_key : type_keys) {
     int32_t type_index = Lib::GetTypeIndex(type_key->data());
     FuncObj *func = nullptr;
     if (type_index != kMLCTensor) {
       func = Lib::_init(type_index);
+      fieldwise_constructors.push_back(FieldwiseInit::For(Lib::GetTypeInfo(type_index), func));
     } else {
+      fieldwise_constructors.push_back(std::nullopt);
       json_type_index_tensor = static_cast<int32_t>(constructors.size());
     }
+    if (type_index == kMLCTypedList) {
+      json_type_index_typed_list = static_cast<int32_t>(constructors.size());
+    }
     constructors.push_back(func);
   }
-  auto invoke_init = [&constructors](UList args) {
+  auto invoke_init = [&constructors, &fieldwise_constructors](UList args) {
     int32_t json_type_index = args[0];
+    int32_t num_args = static_cast<int32_t>(args.size()) - 1;
+    const AnyView *init_args = static_cast<const AnyView *>(args->data() + 1);
     Any ret;
-    ::mlc::base::FuncCall(constructors.at(json_type_index), static_cast<int32_t>(args.size()) - 1, args->data() + 1,
-                          &ret);
+    const std::optional<FieldwiseInit> &fieldwise = fieldwise_constructors.at(json_type_index);
+    if (fieldwise.has_value() && fieldwise->AcceptsAsIs(num_args, init_args)) {
+      ret = (*fieldwise)(num_args, init_args);
+    } else {
+      ::mlc::base::FuncCall(constructors.at(json_type_index), num_args, init_args, &ret);
+    }
     return ret;
   };
   // Step 2. Handle tensors
@@ -1506,6 +2537,11 @@ inline Any Deserialize(const char *json_str, int64_t json_str_len) {
         values[i] = tensors[list[1].operator int32_t()];
         continue;
       }
+      if (json_type_index == json_type_index_typed_list) {
+        // Elements are plain scalars, which should not be treated as references
+        values[i] = invoke_init(list);
+        continue;
+      }
       for (int64_t j = 1; j < list.size(); ++j) {
         Any arg = list[j];
         if (arg.type_index == kMLCInt) {
@@ -1539,31 +2575,275 @@ inline Any Deserialize(const char *json_str, int64_t json_str_len) {
   return values->back();
 }
 
+/****************** ObjectPath Interning ******************/
+
+// Hash-consed table of interned paths, keyed by `prev` and the last segment. The table holds no references: an interned
+// path erases its own entry when it is destroyed, so a path is kept alive only by its users, as before.
+struct ObjectPathInternTable {
+  using ObjectPathObj = ::mlc::core::ObjectPathObj;
+  static constexpr uint64_t kNumShards = 16;
+
+  struct Shard {
+    std::mutex mutex;
+    std::unordered_multimap<uint64_t, ObjectPathObj *> paths;
+  };
+
+  static ObjectPathInternTable *Global() {
+    // Never destroyed, so that paths released during static destruction can still unregister themselves
+    static ObjectPathInternTable *table = new ObjectPathInternTable();
+    return table;
+  }
+
+  static uint64_t Hash(const Object *prev, int32_t kind, AnyView key) {
+    return ::mlc::base::HashCombine(reinterpret_cast<uint64_t>(prev), ObjectPathObj::SegmentHash(kind, key));
+  }
+
+  ObjectPath Intern(const ObjectPathObj *prev, int32_t kind, Any key) {
+    uint64_t hash = Hash(prev, kind, key);
+    Shard &shard = shards[hash % kNumShards];
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    auto range = shard.paths.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      ObjectPathObj *path = it->second;
+      if (path->prev.get() == prev && path->kind == kind && ObjectPathObj::SegmentEqual(kind, path->key, key)) {
+        if (::mlc::base::TryIncRef(reinterpret_cast<MLCAny *>(path))) {
+          ObjectPath ret(path);
+          ::mlc::base::DecRef(reinterpret_cast<MLCAny *>(path));
+          return ret;
+        }
+        // The path is being destroyed by another thread; replace its entry with a new one
+        shard.paths.erase(it);
+        break;
+      }
+    }
+    ObjectPath ret = prev ? ObjectPath(kind, std::move(key), prev) : ObjectPath(kind, std::move(key), Null, 1);
+    ret->interned = true;
+    ret->intern_hash = hash;
+    ret->_mlc_header.v.deleter = ObjectPathInternTable::Deleter;
+    shard.paths.emplace(hash, ret.get());
+    return ret;
+  }
+
+  static void Deleter(void *objptr) {
+    ObjectPathObj *path = static_cast<ObjectPathObj *>(objptr);
+    uint64_t hash = path->intern_hash;
+    Shard &shard = Global()->shards[hash % kNumShards];
+    {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      auto range = shard.paths.equal_range(hash);
+      for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == path) {
+          shard.paths.erase(it);
+          break;
+        }
+      }
+    }
+    // Releasing `prev` may destroy it as well, so this happens outside of the lock
+    ::mlc::DefaultObjectAllocator<ObjectPathObj>::Deleter(objptr);
+  }
+
+  Shard shards[kNumShards];
+};
+
+/****************** Structural Interning ******************/
+
+// Collects the objects directly beneath an object that `StructuralEqual` compares field by field or element by element,
+// i.e. all but strings, tensors and typed lists, which are compared by value
+struct CompositeChildren {
+  void operator()(MLCTypeField *, StructureFieldKind, Any *v) { Add(*v); }
+  void operator()(MLCTypeField *, StructureFieldKind, ObjectRef *v) { Add(v->get()); }
+  void operator()(MLCTypeField *, StructureFieldKind, Optional<ObjectRef> *v) { Add(v->get()); }
+  template <typename T> void operator()(MLCTypeField *, StructureFieldKind, T *) {}
+
+  void Collect(Object *obj) {
+    int32_t type_index = obj->GetTypeIndex();
+    if (type_index == kMLCList) {
+      for (const Any &v : *reinterpret_cast<UListObj *>(obj)) {
+        Add(v);
+      }
+    } else if (type_index == kMLCDict) {
+      for (auto &[k, v] : *reinterpret_cast<UDictObj *>(obj)) {
+        Add(k);
+        Add(v);
+      }
+    } else {
+      VisitStructure(obj, Lib::GetTypeInfo(type_index), *this);
+    }
+  }
+  void Add(AnyView v) {
+    int32_t type_index = v.type_index;
+    if (type_index >= kMLCStaticObjectBegin && type_index != kMLCStr && type_index != kMLCTensor &&
+        type_index != kMLCTypedList) {
+      children.push_back(v.operator Object *());
+    }
+  }
+
+  std::vector<Object *> children;
+};
+
+// Hash-consing table of structurally distinct objects. Objects are bucketed by structural hash and told apart with
+// `StructuralEqual`, so a bucket never holds two equal objects. Readers share the lock, and only misses take it
+// exclusively. Representatives are kept alive by the table.
+//
+// Objects whose subtrees have no variables or binders are equal iff their children share representatives, so such
+// representatives and their children are also recorded in `canonical_`. Comparisons stop at children found there, and
+// `InternGraph`, which interns children first, compares each object against a candidate in time linear in its own size.
+struct StructuralInternTableObj : public Object {
+  bool bind_free_vars;
+  bool tensor_content;
+
+  explicit StructuralInternTableObj(bool bind_free_vars, bool tensor_content)
+      : bind_free_vars(bind_free_vars), tensor_content(tensor_content) {}
+
+  // Returns the canonical representative of `node`, which becomes one itself if there is none yet
+  Any Intern(Any node) {
+    if (node.type_index < kMLCStaticObjectBegin) {
+      return node;
+    }
+    Object *obj = node.operator Object *();
+    uint64_t hash = StructuralHashImpl(obj, tensor_content);
+    return InternHashed(obj, hash, nullptr, nullptr);
+  }
+
+  // Returns the canonical representative of `node`, or None if there is none
+  Any Lookup(Any node) {
+    if (node.type_index < kMLCStaticObjectBegin) {
+      return node;
+    }
+    Object *obj = node.operator Object *();
+    uint64_t hash = StructuralHashImpl(obj, tensor_content);
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return Find(obj, hash, nullptr);
+  }
+
+  // Interns every list, dict and dataclass object reachable from `root`, children before parents, and maps each of them
+  // to its canonical representative. Child hashes are memoized, so the graph is hashed in a single pass.
+  UDict InternGraph(Any root) {
+    UDict ret;
+    if (root.type_index < kMLCStaticObjectBegin) {
+      return ret;
+    }
+    std::vector<std::pair<Object *, uint64_t>> post_order;
+    StructuralHashImpl(root.operator Object *(), tensor_content, &post_order);
+    // Objects of the graph whose subtrees have no variables or binders, mapped to their representatives
+    SEqualCanonical::LocalMap canonical;
+    CompositeChildren composite;
+    std::vector<Object *> &children = composite.children;
+    for (const auto &[obj, hash] : post_order) {
+      children.clear();
+      composite.Collect(obj);
+      StructureKind kind = static_cast<StructureKind>(Lib::GetTypeInfo(obj->GetTypeIndex())->structure_kind);
+      bool closed = kind != StructureKind::kBind && kind != StructureKind::kVar &&
+                    std::all_of(children.begin(), children.end(), [&](Object *c) { return canonical.count(c); });
+      Any rep = InternHashed(obj, hash, &canonical, closed ? &children : nullptr);
+      if (closed) {
+        canonical[obj] = rep.operator Object *();
+      }
+      ret[obj] = std::move(rep);
+    }
+    return ret;
+  }
+
+  int64_t Size() {
+    std::shared_lock<std::shared_mutex> lock(mutex_);
+    return static_cast<int64_t>(table_.size());
+  }
+
+  MLC_DEF_DYN_TYPE(MLC_EXPORTS, StructuralInternTableObj, Object, "mlc.core.StructuralInternTable");
+
+private:
+  // `local` maps objects interned earlier in the same graph to their representatives. `closed_children` is given iff
+  // the subtree of `obj` has no variables or binders, and lists its composite children, all of which are in `local`.
+  Any InternHashed(Object *obj, uint64_t hash, const SEqualCanonical::LocalMap *local,
+                   const std::vector<Object *> *closed_children) {
+    {
+      std::shared_lock<std::shared_mutex> lock(mutex_);
+      if (Any ret = Find(obj, hash, local); ret.type_index != kMLCNone) {
+        return ret;
+      }
+    }
+    std::unique_lock<std::shared_mutex> lock(mutex_);
+    // Another writer may have interned an equal object in between
+    if (Any ret = Find(obj, hash, local); ret.type_index != kMLCNone) {
+      return ret;
+    }
+    table_.emplace(hash, ObjectRef(obj));
+    if (closed_children != nullptr) {
+      canonical_.emplace(obj, std::make_pair(ObjectRef(obj), ObjectRef(obj)));
+      for (Object *child : *closed_children) {
+        canonical_.emplace(child, std::make_pair(ObjectRef(child), ObjectRef(local->at(child))));
+      }
+    }
+    return Any(obj);
+  }
+
+  // Requires `mutex_` to be held
+  Any Find(Object *obj, uint64_t hash, const SEqualCanonical::LocalMap *local) {
+    SEqualCanonical canonical{local, &canonical_};
+    auto range = table_.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+      Object *candidate = it->second.get();
+      if (candidate == obj) {
+        return Any(candidate);
+      }
+      SEqualResult result = StructuralEqualImpl<SEqualMode::kFast>(obj, candidate, bind_free_vars, tensor_content,
+                                                                   nullptr, nullptr, &canonical);
+      if (result.kind == SEqualMismatch::kNone) {
+        return Any(candidate);
+      }
+    }
+    return Any();
+  }
+
+  std::shared_mutex mutex_;
+  std::unordered_multimap<uint64_t, ObjectRef> table_;
+  SEqualCanonical::TableMap canonical_;
+};
+
+struct StructuralInternTable : public ObjectRef {
+  MLC_DEF_OBJ_REF(MLC_EXPORTS, StructuralInternTable, StructuralInternTableObj, ObjectRef)
+      .Field("bind_free_vars", &StructuralInternTableObj::bind_free_vars, /*frozen=*/true)
+      .Field("tensor_content", &StructuralInternTableObj::tensor_content, /*frozen=*/true)
+      .StaticFn("__init__", InitOf<StructuralInternTableObj, bool, bool>)
+      .MemFn("intern", &StructuralInternTableObj::Intern)
+      .MemFn("lookup", &StructuralInternTableObj::Lookup)
+      .MemFn("intern_graph", &StructuralInternTableObj::InternGraph)
+      .MemFn("size", &StructuralInternTableObj::Size);
+};
+
 } // namespace
 } // namespace mlc
 
 namespace mlc {
 namespace registry {
 
-bool StructuralEqual(AnyView lhs, AnyView rhs, bool bind_free_vars, bool assert_mode) {
+ObjectPath ObjectPathIntern(const ::mlc::core::ObjectPathObj *prev, int32_t kind, Any key) {
+  return ::mlc::ObjectPathInternTable::Global()->Intern(prev, kind, std::move(key));
+}
+
+bool StructuralEqual(AnyView lhs, AnyView rhs, bool bind_free_vars, bool assert_mode, bool tensor_content) {
+  // TODO: support non objects
+  Object *lhs_obj = lhs.operator Object *();
+  Object *rhs_obj = rhs.operator Object *();
+  if (!assert_mode) {
+    return ::mlc::StructuralEqualImpl<SEqualMode::kFast>(lhs_obj, rhs_obj, bind_free_vars, tensor_content).kind ==
+           SEqualMismatch::kNone;
+  }
   try {
-    // TODO: support non objects
-    ::mlc::StructuralEqualImpl(lhs.operator Object *(), rhs.operator Object *(), bind_free_vars);
-    return true;
+    ::mlc::StructuralEqualImpl<SEqualMode::kReport>(lhs_obj, rhs_obj, bind_free_vars, tensor_content);
   } catch (SEqualError &e) {
-    if (assert_mode) {
-      std::ostringstream os;
-      os << "Structural equality check failed at " << e.path << ": " << e.what();
-      MLC_THROW(ValueError) << os.str();
-    }
+    std::ostringstream os;
+    os << "Structural equality check failed at " << e.path << ": " << e.what();
+    MLC_THROW(ValueError) << os.str();
   }
-  return false;
+  return true;
 }
 
-Optional<Str> StructuralEqualFailReason(AnyView lhs, AnyView rhs, bool bind_free_vars) {
+Optional<Str> StructuralEqualFailReason(AnyView lhs, AnyView rhs, bool bind_free_vars, bool tensor_content) {
   try {
     // TODO: support non objects
-    ::mlc::StructuralEqualImpl(lhs.operator Object *(), rhs.operator Object *(), bind_free_vars);
+    ::mlc::StructuralEqualImpl<SEqualMode::kReport>(lhs.operator Object *(), rhs.operator Object *(), bind_free_vars,
+                                                    tensor_content);
   } catch (SEqualError &e) {
     std::ostringstream os;
     os << "Structural equality check failed at " << e.path << ": " << e.what();
@@ -1572,13 +2852,41 @@ Optional<Str> StructuralEqualFailReason(AnyView lhs, AnyView rhs, bool bind_free
   return Null;
 }
 
-int64_t StructuralHash(AnyView root) {
+UList StructuralDiff(AnyView lhs, AnyView rhs, bool bind_free_vars, bool tensor_content, int64_t max_diffs) {
   // TODO: support non objects
-  return static_cast<int64_t>(::mlc::StructuralHashImpl(root.operator Object *()));
+  Object *lhs_obj = lhs.operator Object *();
+  Object *rhs_obj = rhs.operator Object *();
+  ::mlc::SEqualDiffs diffs;
+  diffs.max_diffs = max_diffs;
+  try {
+    std::vector<std::pair<Object *, uint64_t>> post_order;
+    ::mlc::StructuralHashImpl(lhs_obj, tensor_content, &post_order);
+    diffs.lhs_hashes.insert(post_order.begin(), post_order.end());
+    post_order.clear();
+    ::mlc::StructuralHashImpl(rhs_obj, tensor_content, &post_order);
+    diffs.rhs_hashes.insert(post_order.begin(), post_order.end());
+  } catch (SEqualError &) {
+    // `mlc.Func`, `mlc.Error` and `mlc.Opaque` cannot be hashed, in which case no subtree is skipped
+    diffs.lhs_hashes.clear();
+    diffs.rhs_hashes.clear();
+  }
+  ::mlc::StructuralEqualImpl<SEqualMode::kDiff>(lhs_obj, rhs_obj, bind_free_vars, tensor_content, nullptr, &diffs);
+  UList ret;
+  for (SEqualDiff &diff : diffs.items) {
+    ret.push_back(UList{diff.lhs_path, diff.rhs_path, Str(diff.reason)});
+  }
+  return ret;
+}
+
+int64_t StructuralHash(AnyView root, bool tensor_content) {
+  // TODO: support non objects
+  return static_cast<int64_t>(::mlc::StructuralHashImpl(root.operator Object *(), tensor_content));
 }
 
 Any CopyShallow(AnyView source) { return CopyShallowImpl(source); }
-Any CopyDeep(AnyView source) { return CopyDeepImpl(source); }
+Any CopyDeep(AnyView source, bool share_frozen, int32_t num_threads) {
+  return CopyDeepImpl(source, share_frozen, num_threads);
+}
 void CopyReplace(int32_t num_args, const AnyView *args, Any *ret) { CopyReplaceImpl(num_args, args, ret); }
 
 Any JSONLoads(AnyView json_str) {
@@ -1599,12 +2907,22 @@ Any JSONDeserialize(AnyView json_str) {
   }
 }
 
-Str JSONSerialize(AnyView source) { return ::mlc::Serialize(source); }
+Str JSONSerialize(AnyView source, bool dedup_tensor_content) {
+  return ::mlc::Serialize(source, dedup_tensor_content);
+}
 
 Str TensorToBytes(const TensorObj *src) {
   return ::mlc::TensorToBytes(&src->tensor); //
 }
 
+// Chunks are binary, so `write` receives each of them as `(data, size)` rather than as a `Str`, which Python would
+// decode as UTF-8. `data` is only valid during the call
+void TensorToBytesChunked(const TensorObj *src, int64_t chunk_size, Func write) {
+  ::mlc::TensorToBytesChunked(&src->tensor, chunk_size, [&write](const uint8_t *data, int64_t size) {
+    write(static_cast<void *>(const_cast<uint8_t *>(data)), size);
+  });
+}
+
 Str TensorToBase64(const TensorObj *src) {
   Str bytes = ::mlc::TensorToBytes(&src->tensor);
   return ::mlc::Base64Encode(reinterpret_cast<uint8_t *>(bytes->data()), bytes->size());
@@ -1634,5 +2952,29 @@ Tensor TensorFromBase64(AnyView any) {
   }
 }
 
+Tensor TensorEmpty(UList shape, DLDataType dtype, DLDevice device) {
+  std::vector<int64_t> dims;
+  dims.reserve(shape.size());
+  for (const Any &dim : shape) {
+    dims.push_back(dim.operator int64_t());
+  }
+  return ::mlc::TensorEmpty(static_cast<int32_t>(dims.size()), dims.data(), dtype, device);
+}
+
+UDict TensorPoolStats() {
+  ::mlc::registry::tensor_pool::CPUMemoryPool::Stats stats =
+      ::mlc::registry::tensor_pool::CPUMemoryPool::Global()->GetStats();
+  UDict ret;
+  ret["bytes_in_use"] = stats.bytes_in_use;
+  ret["bytes_cached"] = stats.bytes_cached;
+  ret["peak_bytes_in_use"] = stats.peak_bytes_in_use;
+  ret["num_allocs"] = stats.num_allocs;
+  ret["num_cache_hits"] = stats.num_cache_hits;
+  ret["num_frees"] = stats.num_frees;
+  return ret;
+}
+
+void TensorPoolRelease() { ::mlc::registry::tensor_pool::CPUMemoryPool::Global()->Release(); }
+
 } // namespace registry
 } // namespace mlc
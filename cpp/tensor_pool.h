@@ -0,0 +1,135 @@
+#ifndef MLC_TENSOR_POOL_H_
+#define MLC_TENSOR_POOL_H_
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <unordered_map>
+#include <vector>
+#ifdef _MSC_VER
+#include <malloc.h>
+#endif
+
+namespace mlc {
+namespace registry {
+namespace tensor_pool {
+
+// Caching allocator of 64-byte aligned host memory. Requests are rounded up to a size class, and freed blocks are kept
+// per class for reuse instead of being returned to the system, up to `kMaxCachedBytes` in total.
+class CPUMemoryPool {
+public:
+  static constexpr int64_t kAlignment = 64;
+  static constexpr int64_t kMaxCachedBytes = int64_t(1) << 30;
+
+  struct Stats {
+    int64_t bytes_in_use = 0;
+    int64_t bytes_cached = 0;
+    int64_t peak_bytes_in_use = 0;
+    int64_t num_allocs = 0;
+    int64_t num_cache_hits = 0;
+    int64_t num_frees = 0;
+  };
+
+  static CPUMemoryPool *Global() {
+    // Leaked on purpose, so that tensors destroyed during static destruction can still return their blocks
+    static CPUMemoryPool *pool = new CPUMemoryPool();
+    return pool;
+  }
+
+  // Rounds up to a multiple of a quarter of the largest power of two not above `num_bytes`, so at most 25% is wasted
+  static int64_t SizeClass(int64_t num_bytes) {
+    int64_t granularity = kAlignment;
+    while (granularity * 8 <= num_bytes) {
+      granularity *= 2;
+    }
+    return num_bytes <= 0 ? kAlignment : (num_bytes + granularity - 1) / granularity * granularity;
+  }
+
+  void *Alloc(int64_t num_bytes) {
+    int64_t size = SizeClass(num_bytes);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++stats_.num_allocs;
+      stats_.bytes_in_use += size;
+      stats_.peak_bytes_in_use = std::max(stats_.peak_bytes_in_use, stats_.bytes_in_use);
+      if (auto it = free_lists_.find(size); it != free_lists_.end() && !it->second.empty()) {
+        void *ret = it->second.back();
+        it->second.pop_back();
+        ++stats_.num_cache_hits;
+        stats_.bytes_cached -= size;
+        return ret;
+      }
+    }
+    void *ret = SystemAlloc(size);
+    if (ret == nullptr) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stats_.bytes_in_use -= size;
+      throw std::bad_alloc();
+    }
+    return ret;
+  }
+
+  void Free(void *ptr, int64_t num_bytes) {
+    int64_t size = SizeClass(num_bytes);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      ++stats_.num_frees;
+      stats_.bytes_in_use -= size;
+      if (stats_.bytes_cached + size <= kMaxCachedBytes) {
+        stats_.bytes_cached += size;
+        free_lists_[size].push_back(ptr);
+        return;
+      }
+    }
+    SystemFree(ptr);
+  }
+
+  // Returns all cached blocks to the system
+  void Release() {
+    std::unordered_map<int64_t, std::vector<void *>> free_lists;
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      free_lists.swap(free_lists_);
+      stats_.bytes_cached = 0;
+    }
+    for (auto &kv : free_lists) {
+      for (void *ptr : kv.second) {
+        SystemFree(ptr);
+      }
+    }
+  }
+
+  Stats GetStats() {
+    std::lock_guard<std::mutex> lock(mutex_);
+    return stats_;
+  }
+
+private:
+  static void *SystemAlloc(int64_t size) {
+#ifdef _MSC_VER
+    return _aligned_malloc(static_cast<size_t>(size), kAlignment);
+#else
+    return std::aligned_alloc(kAlignment, static_cast<size_t>(size));
+#endif
+  }
+
+  static void SystemFree(void *ptr) {
+#ifdef _MSC_VER
+    _aligned_free(ptr);
+#else
+    std::free(ptr);
+#endif
+  }
+
+  std::mutex mutex_;
+  std::unordered_map<int64_t, std::vector<void *>> free_lists_;
+  Stats stats_;
+};
+
+} // namespace tensor_pool
+} // namespace registry
+} // namespace mlc
+
+#endif // MLC_TENSOR_POOL_H_
@@ -0,0 +1,143 @@
+#ifndef MLC_THREAD_POOL_H_
+#define MLC_THREAD_POOL_H_
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mlc {
+namespace registry {
+
+// A fork-join pool whose workers live as long as the pool. The calling thread participates in every `ParallelFor`.
+struct ThreadPool {
+  static int32_t NumThreads(int32_t num_threads) {
+    if (num_threads <= 0) {
+      num_threads = static_cast<int32_t>(std::thread::hardware_concurrency());
+    }
+    return std::max(num_threads, 1);
+  }
+
+  explicit ThreadPool(int32_t num_threads) {
+    num_threads = NumThreads(num_threads);
+    this->workers.reserve(num_threads - 1);
+    for (int32_t i = 1; i < num_threads; ++i) {
+      this->workers.emplace_back([this, i]() { this->WorkerLoop(i); });
+    }
+  }
+
+  ~ThreadPool() {
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->stop = true;
+    }
+    this->cv_start.notify_all();
+    for (std::thread &worker : this->workers) {
+      worker.join();
+    }
+  }
+
+  int32_t Size() const { return static_cast<int32_t>(this->workers.size()) + 1; }
+
+  // Runs `task(i, thread_id)` for every `i` in `[0, n)`, where `thread_id` in `[0, Size())` identifies the thread
+  // running it, and rethrows the first exception raised by any of the tasks
+  void ParallelFor(int64_t n, const std::function<void(int64_t, int32_t)> &task) {
+    if (n <= 0) {
+      return;
+    }
+    if (this->workers.empty() || n == 1) {
+      for (int64_t i = 0; i < n; ++i) {
+        task(i, 0);
+      }
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> lock(this->mutex);
+      this->task = &task;
+      this->num_tasks = n;
+      this->grain = std::max<int64_t>(1, n / (static_cast<int64_t>(this->Size()) * 8));
+      this->next.store(0, std::memory_order_relaxed);
+      this->num_running = static_cast<int32_t>(this->workers.size());
+      this->error = nullptr;
+      ++this->generation;
+    }
+    this->cv_start.notify_all();
+    this->RunChunks(0);
+    std::exception_ptr error;
+    {
+      std::unique_lock<std::mutex> lock(this->mutex);
+      this->cv_done.wait(lock, [this]() { return this->num_running == 0; });
+      this->task = nullptr;
+      std::swap(error, this->error);
+    }
+    if (error) {
+      std::rethrow_exception(error);
+    }
+  }
+
+private:
+  void RunChunks(int32_t thread_id) {
+    for (;;) {
+      int64_t begin = this->next.fetch_add(this->grain, std::memory_order_relaxed);
+      if (begin >= this->num_tasks) {
+        break;
+      }
+      int64_t end = std::min(begin + this->grain, this->num_tasks);
+      try {
+        for (int64_t i = begin; i < end; ++i) {
+          (*this->task)(i, thread_id);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (!this->error) {
+          this->error = std::current_exception();
+        }
+        this->next.store(this->num_tasks, std::memory_order_relaxed);
+      }
+    }
+  }
+
+  void WorkerLoop(int32_t thread_id) {
+    uint64_t seen_generation = 0;
+    for (;;) {
+      {
+        std::unique_lock<std::mutex> lock(this->mutex);
+        this->cv_start.wait(lock, [&]() { return this->stop || this->generation != seen_generation; });
+        if (this->stop) {
+          return;
+        }
+        seen_generation = this->generation;
+      }
+      this->RunChunks(thread_id);
+      {
+        std::lock_guard<std::mutex> lock(this->mutex);
+        if (--this->num_running == 0) {
+          this->cv_done.notify_one();
+        }
+      }
+    }
+  }
+
+  std::vector<std::thread> workers;
+  std::mutex mutex;
+  std::condition_variable cv_start;
+  std::condition_variable cv_done;
+  const std::function<void(int64_t, int32_t)> *task = nullptr;
+  int64_t num_tasks = 0;
+  int64_t grain = 1;
+  std::atomic<int64_t> next{0};
+  int32_t num_running = 0;
+  uint64_t generation = 0;
+  std::exception_ptr error = nullptr;
+  bool stop = false;
+};
+
+} // namespace registry
+} // namespace mlc
+
+#endif // MLC_THREAD_POOL_H_
@@ -0,0 +1,128 @@
+#ifndef MLC_XXHASH_H_
+#define MLC_XXHASH_H_
+
+#include <cstdint>
+#include <cstring>
+
+namespace mlc {
+namespace registry {
+namespace xxhash {
+
+// Streaming XXH64. Input is consumed in 32-byte stripes by four independent accumulators, which keeps several
+// multiplications in flight per cycle, unlike a single `HashCombine` chain over 8-byte words.
+class XXH64 {
+public:
+  explicit XXH64(uint64_t seed = 0)
+      : acc_{seed + kPrime1 + kPrime2, seed + kPrime2, seed, seed - kPrime1}, seed_(seed) {}
+
+  void Update(const uint8_t *data, int64_t len) {
+    total_len_ += static_cast<uint64_t>(len);
+    if (buffered_ + len < kStripe) {
+      std::memcpy(buffer_ + buffered_, data, len);
+      buffered_ += len;
+      return;
+    }
+    if (buffered_ > 0) {
+      int64_t n = kStripe - buffered_;
+      std::memcpy(buffer_ + buffered_, data, n);
+      Consume(buffer_);
+      data += n;
+      len -= n;
+      buffered_ = 0;
+    }
+    const uint8_t *end = data + len;
+    for (; data + kStripe <= end; data += kStripe) {
+      Consume(data);
+    }
+    buffered_ = end - data;
+    std::memcpy(buffer_, data, buffered_);
+  }
+
+  uint64_t Digest() const {
+    uint64_t h;
+    if (total_len_ >= static_cast<uint64_t>(kStripe)) {
+      h = Rotl(acc_[0], 1) + Rotl(acc_[1], 7) + Rotl(acc_[2], 12) + Rotl(acc_[3], 18);
+      for (uint64_t acc : acc_) {
+        h = (h ^ Round(0, acc)) * kPrime1 + kPrime4;
+      }
+    } else {
+      h = seed_ + kPrime5;
+    }
+    h += total_len_;
+    const uint8_t *p = buffer_;
+    const uint8_t *end = buffer_ + buffered_;
+    for (; p + 8 <= end; p += 8) {
+      h = Rotl(h ^ Round(0, Read64(p)), 27) * kPrime1 + kPrime4;
+    }
+    if (p + 4 <= end) {
+      h = Rotl(h ^ (Read32(p) * kPrime1), 23) * kPrime2 + kPrime3;
+      p += 4;
+    }
+    for (; p < end; ++p) {
+      h = Rotl(h ^ (*p * kPrime5), 11) * kPrime1;
+    }
+    h ^= h >> 33;
+    h *= kPrime2;
+    h ^= h >> 29;
+    h *= kPrime3;
+    h ^= h >> 32;
+    return h;
+  }
+
+  static uint64_t Hash(const uint8_t *data, int64_t len, uint64_t seed = 0) {
+    XXH64 state(seed);
+    state.Update(data, len);
+    return state.Digest();
+  }
+
+private:
+  static constexpr int64_t kStripe = 32;
+  static constexpr uint64_t kPrime1 = 0x9E3779B185EBCA87ULL;
+  static constexpr uint64_t kPrime2 = 0xC2B2AE3D27D4EB4FULL;
+  static constexpr uint64_t kPrime3 = 0x165667B19E3779F9ULL;
+  static constexpr uint64_t kPrime4 = 0x85EBCA77C2B2AE63ULL;
+  static constexpr uint64_t kPrime5 = 0x27D4EB2F165667C5ULL;
+
+  static uint64_t Rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+  static uint64_t Round(uint64_t acc, uint64_t input) { return Rotl(acc + input * kPrime2, 31) * kPrime1; }
+  // Reads are little endian, so that hashes agree across platforms
+  static uint64_t Read64(const uint8_t *p) {
+    uint64_t ret;
+    std::memcpy(&ret, p, 8);
+#if MLC_IS_BIG_ENDIAN == 1
+    ret = ByteSwap64(ret);
+#endif
+    return ret;
+  }
+  static uint64_t Read32(const uint8_t *p) {
+    uint32_t ret;
+    std::memcpy(&ret, p, 4);
+#if MLC_IS_BIG_ENDIAN == 1
+    ret = static_cast<uint32_t>(ByteSwap64(ret) >> 32);
+#endif
+    return ret;
+  }
+  static uint64_t ByteSwap64(uint64_t x) {
+    x = ((x & 0x00FF00FF00FF00FFULL) << 8) | ((x >> 8) & 0x00FF00FF00FF00FFULL);
+    x = ((x & 0x0000FFFF0000FFFFULL) << 16) | ((x >> 16) & 0x0000FFFF0000FFFFULL);
+    return (x << 32) | (x >> 32);
+  }
+  void Consume(const uint8_t *stripe) {
+    acc_[0] = Round(acc_[0], Read64(stripe));
+    acc_[1] = Round(acc_[1], Read64(stripe + 8));
+    acc_[2] = Round(acc_[2], Read64(stripe + 16));
+    acc_[3] = Round(acc_[3], Read64(stripe + 24));
+  }
+
+  uint64_t acc_[4];
+  uint64_t seed_;
+  uint64_t total_len_ = 0;
+  uint8_t buffer_[kStripe] = {};
+  int64_t buffered_ = 0;
+};
+
+} // namespace xxhash
+} // namespace registry
+} // namespace mlc
+
+#endif // MLC_XXHASH_H_
@@ -30,8 +30,9 @@ struct Lib {
   static FuncObj *FuncGetGlobal(const char *name, bool allow_missing = false);
   static ::mlc::Str CxxStr(AnyView obj);
   static ::mlc::Str Str(AnyView obj);
-  static int64_t StructuralHash(AnyView obj);
-  static bool StructuralEqual(AnyView a, AnyView b, bool bind_free_vars = true, bool assert_mode = false);
+  static int64_t StructuralHash(AnyView obj, bool tensor_content = false);
+  static bool StructuralEqual(AnyView a, AnyView b, bool bind_free_vars = true, bool assert_mode = false,
+                              bool tensor_content = false);
   static Any IRPrint(AnyView obj, AnyView printer, AnyView path);
   static const char *DeviceTypeToStr(int32_t device_type);
   static int32_t DeviceTypeFromStr(const char *source);
@@ -41,6 +42,9 @@ struct Lib {
   static void DataTypeRegister(const char *name, int32_t dtype_bits);
 
   static FuncObj *_init(int32_t type_index) { return VTableGetFunc(init, type_index, "__init__"); }
+  static FuncObj *_post_init(int32_t type_index) {
+    return VTableGetFunc(post_init, type_index, "__post_init__", /*allow_missing=*/true);
+  }
   static VTable MakeVTable(const char *name) {
     MLCVTableHandle vtable = nullptr;
     MLC_CHECK_ERR(::MLCVTableCreate(_lib, name, &vtable));
@@ -84,7 +88,8 @@ struct Lib {
   }
 
 private:
-  static FuncObj *VTableGetFunc(MLCVTableHandle vtable, int32_t type_index, const char *vtable_name) {
+  static FuncObj *VTableGetFunc(MLCVTableHandle vtable, int32_t type_index, const char *vtable_name,
+                                bool allow_missing = false) {
     MLCAny func{};
     MLC_CHECK_ERR(::MLCVTableGetFunc(vtable, type_index, true, &func));
     if (!::mlc::base::IsTypeIndexPOD(func.type_index)) {
@@ -92,6 +97,9 @@ private:
     }
     FuncObj *ret = reinterpret_cast<FuncObj *>(func.v.v_obj);
     if (func.type_index == kMLCNone) {
+      if (allow_missing) {
+        return nullptr;
+      }
       MLC_THROW(TypeError) << "Function `" << vtable_name << "` for type: " << GetTypeKey(type_index)
                            << " is not defined in the vtable";
     } else if (func.type_index != kMLCFunc) {
@@ -114,6 +122,7 @@ private:
   static MLC_SYMBOL_HIDE inline MLCVTableHandle str = VTableGetGlobal("__str__");
   static MLC_SYMBOL_HIDE inline MLCVTableHandle ir_print = VTableGetGlobal("__ir_print__");
   static MLC_SYMBOL_HIDE inline MLCVTableHandle init = VTableGetGlobal("__init__");
+  static MLC_SYMBOL_HIDE inline MLCVTableHandle post_init = VTableGetGlobal("__post_init__");
 };
 
 } // namespace mlc
@@ -20,6 +20,7 @@
 #include <memory>
 #include <mlc/backtrace/c_api.h>
 #include <sstream>
+#include <string>
 #include <type_traits>
 #if MLC_DEBUG_MODE == 1
 #include <iostream>
@@ -61,11 +62,12 @@
 #define MLC_FUNC_SIG __func__
 #endif
 
-#define MLC_STR(__x) #__x
+#define MLC_STR_(__x) #__x
+#define MLC_STR(__x) MLC_STR_(__x)
 #define MLC_STR_CONCAT_(__x, __y) __x##__y
 #define MLC_STR_CONCAT(__x, __y) MLC_STR_CONCAT_(__x, __y)
 #define MLC_UNIQUE_ID() MLC_STR_CONCAT(__mlc_unique_id_, __COUNTER__)
-#define MLC_TRACEBACK_HERE() MLCTraceback(__FILE__, MLC_STR(__LINE__), MLC_FUNC_SIG)
+#define MLC_TRACEBACK_HERE() ::mlc::base::TracebackHere(__FILE__, MLC_STR(__LINE__), MLC_FUNC_SIG)
 #define MLC_THROW(ErrorKind) ::mlc::base::ErrorBuilder(#ErrorKind, MLC_TRACEBACK_HERE()).Get()
 #define MLC_MAKE_ERROR_HERE(ErrorKind, Msg) ::mlc::base::MLCCreateError(#ErrorKind, Msg, MLC_TRACEBACK_HERE())
 
@@ -90,6 +92,21 @@ namespace base {
 
 struct TemporaryTypeError : public std::exception {};
 
+// Unwinding and symbolizing the stack dominates the cost of throwing, so it can be turned off at build time with
+// `MLC_DISABLE_TRACEBACK`, or at runtime with `MLCTracebackSetEnabled`, in which case only the call site is recorded
+inline MLCByteArray TracebackHere(const char *filename, const char *lineno, const char *funcname) {
+  if (::MLCTracebackGetEnabled()) {
+    return MLCTraceback(filename, lineno, funcname);
+  }
+  thread_local std::string buffer;
+  buffer.clear();
+  for (const char *str : {filename, lineno, funcname}) {
+    buffer.append(str);
+    buffer.push_back('\0');
+  }
+  return MLCByteArray{static_cast<int64_t>(buffer.size()), buffer.data()};
+}
+
 [[noreturn]] void MLCThrowError(const char *kind, MLCByteArray message, MLCByteArray traceback) noexcept(false);
 Any MLCCreateError(const char *kind, const std::string &message, MLCByteArray traceback);
 
@@ -222,6 +239,28 @@ MLC_INLINE void DecRef(MLCAny *obj) {
   }
 }
 
+// Increments the reference count unless it is zero, i.e. unless the object is already being destroyed
+MLC_INLINE bool TryIncRef(MLCAny *obj) {
+#ifdef _MSC_VER
+  long ref_cnt = _InterlockedCompareExchange(reinterpret_cast<volatile long *>(&obj->ref_cnt), 0, 0);
+  while (ref_cnt != 0) {
+    long prev = _InterlockedCompareExchange(reinterpret_cast<volatile long *>(&obj->ref_cnt), ref_cnt + 1, ref_cnt);
+    if (prev == ref_cnt) {
+      return true;
+    }
+    ref_cnt = prev;
+  }
+#else
+  int32_t ref_cnt = __atomic_load_n(&obj->ref_cnt, __ATOMIC_RELAXED);
+  while (ref_cnt != 0) {
+    if (__atomic_compare_exchange_n(&obj->ref_cnt, &ref_cnt, ref_cnt + 1, true, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+      return true;
+    }
+  }
+#endif
+  return false;
+}
+
 MLC_INLINE int32_t RefCount(MLCAny *obj) {
   if (obj == nullptr) {
     return 0;
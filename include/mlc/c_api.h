@@ -85,6 +85,7 @@ typedef enum {
   kMLCStr = 1005,
   kMLCTensor = 1006,
   kMLCOpaque = 1007,
+  kMLCTypedList = 1008,
   kMLCCoreEnd = 1100,
   // }
   // kMLCTyping [1100: 1200) {
@@ -186,6 +187,15 @@ typedef struct {
   const char *opaque_type_name;
 } MLCOpaque;
 
+typedef struct {
+  MLCAny _mlc_header;
+  int64_t capacity;
+  int64_t size;
+  void *data;          // contiguous array of `size` elements of `dtype`
+  DLDataType dtype;    // one of: int64, float64, bool (1 byte per element)
+  int64_t num_exports; // live buffer exports of `data`, which cannot be reallocated while any is alive
+} MLCTypedList;
+
 typedef struct {
   MLCAny _mlc_header;
 } MLCTypingAny;
@@ -289,6 +299,9 @@ MLC_API int32_t MLCErrorCreate(const char *kind, int64_t num_bytes, const char *
 MLC_API int32_t MLCErrorGetInfo(MLCAny error, int32_t *num_strs, const char ***strs);
 MLC_API int32_t MLCExtObjCreate(int32_t num_bytes, int32_t type_index, MLCAny *ret);
 MLC_API void MLCExtObjDelete(void *objptr);
+// Whether `MLC_TRACEBACK_HERE` captures the full stack, or only the call site. Setting it returns the previous value.
+MLC_API int32_t MLCTracebackGetEnabled();
+MLC_API int32_t MLCTracebackSetEnabled(int32_t enabled);
 #ifdef __cplusplus
 } // MLC_EXTERN_C
 #endif
@@ -11,6 +11,7 @@
 #include "./reflection.h"   // IWYU pragma: export
 #include "./str.h"          // IWYU pragma: export
 #include "./tensor.h"       // IWYU pragma: export
+#include "./typed_list.h"   // IWYU pragma: export
 #include "./typing.h"       // IWYU pragma: export
 #include "./utils.h"        // IWYU pragma: export
 #include "./visitor.h"      // IWYU pragma: export
@@ -140,16 +141,17 @@ inline ::mlc::Str Lib::Str(AnyView obj) {
   ::mlc::base::FuncCall(func, 1, &obj, &ret);
   return ret;
 }
-inline int64_t Lib::StructuralHash(AnyView obj) {
-  static FuncObj *func_hash_s = ::mlc::Lib::FuncGetGlobal("mlc.core.StructuralHash");
+inline int64_t Lib::StructuralHash(AnyView obj, bool tensor_content) {
+  static FuncObj *func_hash_s = ::mlc::Lib::FuncGetGlobal("mlc.core.StructuralHashWithTensorContent");
   Any ret;
-  ::mlc::base::FuncCall(func_hash_s, 1, &obj, &ret);
+  ::mlc::base::FuncCall(func_hash_s, 2, std::array<AnyView, 2>{obj, tensor_content}.data(), &ret);
   return ret;
 }
-inline bool Lib::StructuralEqual(AnyView a, AnyView b, bool bind_free_vars, bool assert_mode) {
-  static FuncObj *func_eq_s = ::mlc::Lib::FuncGetGlobal("mlc.core.StructuralEqual");
+inline bool Lib::StructuralEqual(AnyView a, AnyView b, bool bind_free_vars, bool assert_mode, bool tensor_content) {
+  static FuncObj *func_eq_s = ::mlc::Lib::FuncGetGlobal("mlc.core.StructuralEqualWithTensorContent");
   Any ret;
-  ::mlc::base::FuncCall(func_eq_s, 4, std::array<AnyView, 4>{a, b, bind_free_vars, assert_mode}.data(), &ret);
+  ::mlc::base::FuncCall(func_eq_s, 5,
+                        std::array<AnyView, 5>{a, b, bind_free_vars, assert_mode, tensor_content}.data(), &ret);
   return ret;
 }
 inline Any Lib::IRPrint(AnyView obj, AnyView printer, AnyView path) {
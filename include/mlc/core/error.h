@@ -2,6 +2,8 @@
 #define MLC_CORE_ERROR_H_
 
 #include "./object.h"
+#include <algorithm>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -9,10 +11,17 @@ namespace mlc {
 
 struct ErrorObj : public MLCError {
   struct Allocator;
-  std::string __str__() const { return this->ByteArray(); }
+  std::string __str__() const { return this->Message(); }
   const char *ByteArray() const { return reinterpret_cast<const char *>(this + 1); }
   char *ByteArray() { return reinterpret_cast<char *>(this + 1); }
   const char *kind() const { return MLCError::kind; }
+  const char *Message() const {
+    const ErrorObj *root = this;
+    while (root->inner.defined()) {
+      root = root->inner.get();
+    }
+    return root->ByteArray();
+  }
 
   explicit ErrorObj(const char *kind, MLCByteArray message, MLCByteArray traceback) {
     // Assumption:
@@ -34,14 +43,26 @@ struct ErrorObj : public MLCError {
     byte_array[num_bytes] = '\0';
   }
 
+  explicit ErrorObj(const ErrorObj *prev) : inner(const_cast<ErrorObj *>(prev)) {
+    MLCError::kind = prev->kind();
+    this->ByteArray()[0] = '\0';
+  }
+
   inline Ref<ErrorObj> AppendWith(MLCByteArray traceback) const;
+  // Records that `self` propagates through a call site with `traceback`. Only the new traceback is copied: an error
+  // that is not shared is extended in place, and a shared one is linked to from a new error, so that an error crossing
+  // N boundaries costs O(N) rather than O(N^2) in total. The frames are only split into strings in `GetInfo`.
+  inline static Ref<ErrorObj> Propagate(Ref<ErrorObj> self, MLCByteArray traceback);
 
   void GetInfo(std::vector<const char *> *ret) const {
-    ret->clear();
-    const char *bytes = this->ByteArray();
-    while (*bytes != '\0') {
-      ret->push_back(bytes);
-      bytes += std::strlen(bytes) + 1;
+    if (inner.defined()) {
+      inner->GetInfo(ret);
+    } else {
+      ret->clear();
+      SplitInfo(this->ByteArray(), ret);
+    }
+    for (const std::unique_ptr<char[]> &traceback : tracebacks) {
+      SplitInfo(traceback.get(), ret);
     }
   }
 
@@ -60,6 +81,19 @@ struct ErrorObj : public MLCError {
   }
 
   MLC_DEF_STATIC_TYPE(MLC_EXPORTS, ErrorObj, Object, MLCTypeIndex::kMLCError, "object.Error");
+
+  // The error this one propagates, which holds the message and the frames before `tracebacks`
+  Ref<ErrorObj> inner;
+  // Tracebacks appended by `Propagate`, in the same format as the byte array: '\0'-terminated strings ending with ""
+  std::vector<std::unique_ptr<char[]>> tracebacks;
+
+private:
+  static void SplitInfo(const char *bytes, std::vector<const char *> *ret) {
+    while (*bytes != '\0') {
+      ret->push_back(bytes);
+      bytes += std::strlen(bytes) + 1;
+    }
+  }
 };
 
 struct ErrorObj::Allocator {
@@ -70,6 +104,9 @@ struct ErrorObj::Allocator {
   MLC_INLINE static ErrorObj *New(const char *kind, int64_t num_bytes, const char *bytes) {
     return ::mlc::DefaultObjectAllocator<ErrorObj>::NewWithPad<char>(num_bytes + 1, kind, num_bytes, bytes);
   }
+  MLC_INLINE static ErrorObj *New(const ErrorObj *prev) {
+    return ::mlc::DefaultObjectAllocator<ErrorObj>::NewWithPad<char>(1, prev);
+  }
 };
 
 struct Error : public ObjectRef {
@@ -82,23 +119,31 @@ struct Error : public ObjectRef {
 };
 
 inline Ref<ErrorObj> ErrorObj::AppendWith(MLCByteArray traceback) const {
-  MLCByteArray self;
-  self.bytes = this->ByteArray();
-  self.num_bytes = [&]() -> int64_t {
-    const char *end_bytes = this->ByteArray();
-    while (*end_bytes != '\0') {
-      end_bytes += std::strlen(end_bytes) + 1;
-    }
-    return end_bytes - self.bytes - 1;
-  }();
-  return Ref<ErrorObj>::New(MLCError::kind, self, traceback);
+  std::vector<const char *> info;
+  this->GetInfo(&info);
+  std::string self;
+  for (const char *str : info) {
+    self.append(str);
+    self.push_back('\0');
+  }
+  int64_t num_bytes = std::max<int64_t>(static_cast<int64_t>(self.size()) - 1, 0);
+  return Ref<ErrorObj>::New(MLCError::kind, MLCByteArray{num_bytes, self.data()}, traceback);
+}
+
+inline Ref<ErrorObj> ErrorObj::Propagate(Ref<ErrorObj> self, MLCByteArray traceback) {
+  Ref<ErrorObj> ret = self->_mlc_header.ref_cnt == 1 ? std::move(self) : Ref<ErrorObj>::New(self.get());
+  std::unique_ptr<char[]> bytes(new char[traceback.num_bytes + 2]);
+  std::memcpy(bytes.get(), traceback.bytes, traceback.num_bytes);
+  bytes[traceback.num_bytes] = bytes[traceback.num_bytes + 1] = '\0';
+  ret->tracebacks.push_back(std::move(bytes));
+  return ret;
 }
 
 inline const char *Exception::what() const noexcept(true) {
   if (data_.get() == nullptr) {
     return "mlc::ffi::Exception: Unspecified";
   }
-  return Obj()->ByteArray();
+  return Obj()->Message();
 }
 
 inline Exception::Exception(Ref<ErrorObj> data) : data_(data.get()) {}
@@ -25,6 +25,8 @@ struct FuncObj : public MLCFunc {
   }
 
   static Ref<FuncObj> FromForeign(void *self, MLCDeleterType deleter, MLCFuncSafeCallType safe_call);
+  // Whether the function is created by `FromForeign`, e.g. a Python callable, which may need a runtime lock to call
+  bool IsForeign() const;
 
   static int32_t SafeCallImpl(const FuncObj *self, int32_t num_args, const AnyView *args, Any *ret) {
     MLC_SAFE_CALL_BEGIN();
@@ -94,7 +96,9 @@ inline void FuncCallCheckError(int32_t err_code, MLCAny *ret) noexcept(false) {
   if (err_code == -1) { // string errors
     MLC_THROW(InternalError) << "Error: " << err;
   } else if (err_code == -2) { // error objects
-    throw Exception(err.operator Ref<ErrorObj>()->AppendWith(MLC_TRACEBACK_HERE()));
+    Ref<ErrorObj> obj = err;
+    err.Reset();
+    throw Exception(ErrorObj::Propagate(std::move(obj), MLC_TRACEBACK_HERE()));
   } else { // error code
     MLC_THROW(InternalError) << "Error code: " << err_code;
   }
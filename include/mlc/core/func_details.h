@@ -180,6 +180,28 @@ struct FuncAllocatorImpl<R (Obj::*)(Args...), //
   }
 };
 
+/********** Section 3. Foreign functions *********/
+
+struct ForeignFunc {
+  void operator()(int32_t num_args, const MLCAny *args, MLCAny *ret) const {
+    if (int32_t err_code = safe_call(self, num_args, args, ret)) {
+      ::mlc::base::FuncCallCheckError(err_code, ret);
+    }
+  }
+  void *self;
+  MLCFuncSafeCallType safe_call;
+};
+
+struct ForeignFuncOwned {
+  void operator()(int32_t num_args, const MLCAny *args, MLCAny *ret) const {
+    if (int32_t err_code = safe_call(self.get(), num_args, args, ret)) {
+      ::mlc::base::FuncCallCheckError(err_code, ret);
+    }
+  }
+  std::shared_ptr<void> self;
+  MLCFuncSafeCallType safe_call;
+};
+
 } // namespace core
 } // namespace mlc
 
@@ -189,20 +211,16 @@ template <typename FuncType, typename> MLC_INLINE FuncObj *FuncObj::Allocator::N
 }
 inline Ref<FuncObj> FuncObj::FromForeign(void *self, MLCDeleterType deleter, MLCFuncSafeCallType safe_call) {
   if (deleter == nullptr) {
-    return Ref<FuncObj>::New([self, safe_call](int32_t num_args, const MLCAny *args, MLCAny *ret) {
-      if (int32_t err_code = safe_call(self, num_args, args, ret)) {
-        ::mlc::base::FuncCallCheckError(err_code, ret);
-      }
-    });
+    return Ref<FuncObj>::New(::mlc::core::ForeignFunc{self, safe_call});
   } else {
-    return Ref<FuncObj>::New(
-        [self = std::shared_ptr<void>(self, deleter), safe_call](int32_t num_args, const MLCAny *args, MLCAny *ret) {
-          if (int32_t err_code = safe_call(self.get(), num_args, args, ret)) {
-            ::mlc::base::FuncCallCheckError(err_code, ret);
-          }
-        });
+    return Ref<FuncObj>::New(::mlc::core::ForeignFuncOwned{std::shared_ptr<void>(self, deleter), safe_call});
   }
 }
+inline bool FuncObj::IsForeign() const {
+  using ::mlc::core::FuncCallPacked;
+  return this->call == reinterpret_cast<MLCFuncCallType>(FuncCallPacked<::mlc::core::ForeignFunc>) ||
+         this->call == reinterpret_cast<MLCFuncCallType>(FuncCallPacked<::mlc::core::ForeignFuncOwned>);
+}
 } // namespace mlc
 
 #endif // MLC_CORE_FUNC_DETAILS_H_
@@ -3,6 +3,7 @@
 
 #include "./object.h"
 #include "./str.h"
+#include <array>
 
 namespace mlc {
 namespace core {
@@ -20,6 +21,12 @@ struct ObjectPathObj : public Object {
   Any key;
   Optional<ObjectRef> prev;
   int64_t length;
+  // Not reflected. Interned paths are hash-consed: there is at most one alive interned path per (prev, segment), so
+  // two interned paths are equal iff they are the same object. Paths derived from `InternedRoot()` are interned.
+  bool interned = false;
+  // Not reflected. The intern table key of an interned path, kept so that the path can unregister itself even if its
+  // reflected fields have been modified since
+  uint64_t intern_hash = 0;
 
   explicit ObjectPathObj(int32_t kind, Any key, Optional<ObjectRef> prev, int64_t length)
       : kind(kind), key(key), prev(prev), length(length) {}
@@ -31,6 +38,11 @@ struct ObjectPathObj : public Object {
   ObjectPath WithDictKey(Any dict_key) const;
   ::mlc::Str __str__() const;
   bool Equal(const ObjectPathObj *other) const;
+  // Compare and hash only the last segment, i.e. `kind` and `key`, without looking at `prev`
+  bool SegmentEqual(const ObjectPathObj *other) const { return kind == other->kind && SegmentEqual(kind, key, other->key); }
+  uint64_t SegmentHash() const { return SegmentHash(kind, key); }
+  static bool SegmentEqual(int32_t kind, AnyView lhs, AnyView rhs);
+  static uint64_t SegmentHash(int32_t kind, AnyView key);
   ObjectPathObj *GetPrefix(int64_t prefix_length) const;
   bool IsPrefixOf(const ObjectPathObj *other) const;
 
@@ -39,6 +51,10 @@ struct ObjectPathObj : public Object {
 
 struct ObjectPath : public ObjectRef {
   static ObjectPath Root() { return ObjectPath(-1, Any(), Optional<ObjectRef>(nullptr), 1); }
+  // Opt-in root of interned paths, whose `With*` calls go through a global table so that equal paths are shared
+  static ObjectPath InternedRoot() { return ObjectPath::Intern(nullptr, -1, Any()); }
+  // Extends `prev` by one segment, returning the existing path if `prev` is interned and already has that child
+  static ObjectPath Intern(const ObjectPathObj *prev, int32_t kind, Any key);
 
   MLC_DEF_OBJ_REF(MLC_EXPORTS, ObjectPath, ObjectPathObj, ObjectRef)
       .Field("kind", &ObjectPathObj::kind)
@@ -47,6 +63,7 @@ struct ObjectPath : public ObjectRef {
       .Field("length", &ObjectPathObj::length)
       .StaticFn("__init__", ::mlc::InitOf<ObjectPathObj, int32_t, Any, Optional<ObjectRef>, int64_t>)
       .StaticFn("root", &ObjectPath::Root)
+      .StaticFn("interned_root", &ObjectPath::InternedRoot)
       .MemFn("__str__", &ObjectPathObj::__str__)
       .MemFn("with_field", &ObjectPathObj::WithField)
       .MemFn("with_list_index", &ObjectPathObj::WithListIndex)
@@ -85,73 +102,91 @@ inline ::mlc::Str ObjectPathObj::__str__() const {
   return os.str();
 }
 
+inline ObjectPath ObjectPath::Intern(const ObjectPathObj *prev, int32_t kind, Any key) {
+  if (prev != nullptr && !prev->interned) {
+    return ObjectPath(kind, std::move(key), prev);
+  }
+  static FuncObj *func_intern = ::mlc::Lib::FuncGetGlobal("mlc.core.ObjectPathIntern");
+  Any ret;
+  ::mlc::base::FuncCall(func_intern, 3,
+                        std::array<AnyView, 3>{const_cast<ObjectPathObj *>(prev), kind, key}.data(), &ret);
+  return ret;
+}
+
 inline ObjectPath ObjectPathObj::WithField(const char *field_name) const {
-  return ObjectPath(0, Any(field_name), this);
+  return ObjectPath::Intern(this, 0, Any(field_name));
 }
 
 inline ObjectPath ObjectPathObj::WithListIndex(int64_t list_index) const {
-  return ObjectPath(1, Any(list_index), this);
+  return ObjectPath::Intern(this, 1, Any(list_index));
 }
 
 inline ObjectPath ObjectPathObj::WithDictKey(Any dict_key) const { //
-  return ObjectPath(2, std::move(dict_key), this);
+  return ObjectPath::Intern(this, 2, std::move(dict_key));
 }
 
-inline bool ObjectPathObj::Equal(const ObjectPathObj *other) const {
-#define MLC_OBJ_PATH_CHECK_SEG(LHS, RHS, ObjType)                                                                      \
-  if ((LHS).operator ObjType() != (RHS).operator ObjType()) {                                                          \
-    return false;                                                                                                      \
-  } else {                                                                                                             \
-    continue;                                                                                                          \
+inline bool ObjectPathObj::SegmentEqual(int32_t kind, AnyView lhs, AnyView rhs) {
+  if (kind == -1) {
+    return true;
+  } else if (kind == 0) {
+    return lhs.operator mlc::Str() == rhs.operator mlc::Str();
+  } else if (kind == 1) {
+    return lhs.operator int64_t() == rhs.operator int64_t();
   }
+  int32_t type_index = lhs.GetTypeIndex();
+  if (type_index != rhs.GetTypeIndex()) {
+    return false;
+  } else if (type_index >= kMLCStaticObjectBegin) {
+    return lhs.operator Object *() == rhs.operator Object *();
+  } else if (type_index == kMLCNone) {
+    return true;
+  } else if (type_index == kMLCBool) {
+    return lhs.operator bool() == rhs.operator bool();
+  } else if (type_index == kMLCInt) {
+    return lhs.operator int64_t() == rhs.operator int64_t();
+  } else if (type_index == kMLCFloat) {
+    return lhs.operator double() == rhs.operator double();
+  } else if (type_index == kMLCPtr) {
+    return lhs.operator void *() == rhs.operator void *();
+  } else if (type_index == kMLCDataType) {
+    return mlc::base::DType::Equal(lhs.operator DLDataType(), rhs.operator DLDataType());
+  } else if (type_index == kMLCDevice) {
+    return mlc::base::DeviceEqual(lhs.operator DLDevice(), rhs.operator DLDevice());
+  }
+  MLC_THROW(TypeError) << "Unsupported type index: " << type_index;
+  MLC_UNREACHABLE();
+}
 
-#define MLC_OBJ_PATH_CHECK_SEG_PRED(LHS, RHS, ObjType, PRED)                                                           \
-  if (!PRED((LHS).operator ObjType(), (RHS).operator ObjType())) {                                                     \
-    return false;                                                                                                      \
-  } else {                                                                                                             \
-    continue;                                                                                                          \
+inline uint64_t ObjectPathObj::SegmentHash(int32_t kind, AnyView key) {
+  uint64_t hash = static_cast<uint64_t>(static_cast<int64_t>(kind));
+  int32_t type_index = key.GetTypeIndex();
+  if (kind == -1 || type_index == kMLCNone) {
+    return hash;
+  } else if (kind == 2 && type_index >= kMLCStaticObjectBegin) {
+    // Object keys compare by address, including strings
+    return ::mlc::base::HashCombine(hash, reinterpret_cast<uint64_t>(key.v.v_obj));
+  } else if (type_index == kMLCFloat && key.operator double() == 0.0) {
+    // `0.0` and `-0.0` compare equal
+    return ::mlc::base::HashCombine(hash, 0);
   }
+  return ::mlc::base::HashCombine(hash, ::mlc::base::AnyHash(key));
+}
 
-  if (kind != other->kind || length != other->length) {
+inline bool ObjectPathObj::Equal(const ObjectPathObj *other) const {
+  if (this == other) {
+    return true;
+  } else if (length != other->length || (interned && other->interned)) {
     return false;
   }
   for (const ObjectPathObj *p = this, *q = other; p && q;
        p = p->prev.DynCast<ObjectPathObj>(), q = q->prev.DynCast<ObjectPathObj>()) {
-    if (p->kind != q->kind) {
-      return false;
-    } else if (p->kind == -1) {
+    if (p == q) {
       return true;
-    } else if (p->kind == 0) {
-      MLC_OBJ_PATH_CHECK_SEG(p->key, q->key, mlc::Str);
-    } else if (p->kind == 1) {
-      MLC_OBJ_PATH_CHECK_SEG(p->key, q->key, int64_t);
-    }
-    int32_t type_index = p->key.GetTypeIndex();
-    if (type_index != q->key.GetTypeIndex()) {
+    } else if (!p->SegmentEqual(q)) {
       return false;
-    } else if (type_index >= kMLCStaticObjectBegin) {
-      MLC_OBJ_PATH_CHECK_SEG(p->key, q->key, Object *);
-    } else if (type_index == kMLCNone) {
-      return true;
-    } else if (type_index == kMLCBool) {
-      MLC_OBJ_PATH_CHECK_SEG(p->key, q->key, bool);
-    } else if (type_index == kMLCInt) {
-      MLC_OBJ_PATH_CHECK_SEG(p->key, q->key, int64_t);
-    } else if (type_index == kMLCFloat) {
-      MLC_OBJ_PATH_CHECK_SEG(p->key, q->key, double);
-    } else if (type_index == kMLCPtr) {
-      MLC_OBJ_PATH_CHECK_SEG(p->key, q->key, void *);
-    } else if (type_index == kMLCDataType) {
-      MLC_OBJ_PATH_CHECK_SEG_PRED(p->key, q->key, DLDataType, mlc::base::DType::Equal);
-    } else if (type_index == kMLCDevice) {
-      MLC_OBJ_PATH_CHECK_SEG_PRED(p->key, q->key, DLDevice, mlc::base::DeviceEqual);
-    } else {
-      MLC_THROW(TypeError) << "Unsupported type index: " << type_index;
     }
   }
   return true;
-#undef MLC_OBJ_PATH_CHECK_SEG
-#undef MLC_OBJ_PATH_CHECK_SEG_PRED
 }
 
 inline ObjectPathObj *ObjectPathObj::GetPrefix(int64_t prefix_length) const {
@@ -2,6 +2,7 @@
 #define MLC_CORE_TENSOR_H_
 
 #include "./func.h"
+#include "./list.h"
 #include "./object.h"
 #include "./typing.h"
 #include <numeric>
@@ -36,6 +37,12 @@ struct TensorObj : public MLCTensor {
     return func({source});
   }
 
+  // Allocates an uninitialized compact tensor, from a memory pool on CPU
+  static Ref<TensorObj> Empty(const UList &shape, DLDataType dtype, DLDevice device) {
+    static auto func = ::mlc::base::GetGlobalFuncCall<3>("mlc.core.TensorEmpty");
+    return func({shape, dtype, device});
+  }
+
   Str ToBase64() const {
     static auto func = ::mlc::base::GetGlobalFuncCall<1>("mlc.core.TensorToBase64");
     return func({this});
@@ -60,6 +67,24 @@ struct TensorObj : public MLCTensor {
     return ret;
   }
 
+  // Same as `DLPack`, but versioned, so that consumers such as numpy 2 import the payload as writable
+  DLManagedTensorVersioned *DLPackVersioned() {
+    ::mlc::base::IncRef(&this->_mlc_header);
+    // N.B. This leaks memory if the resulting DLManagedTensorVersioned's deleter is not called.
+    DLManagedTensorVersioned *ret = new DLManagedTensorVersioned();
+    ret->version.major = DLPACK_MAJOR_VERSION;
+    ret->version.minor = DLPACK_MINOR_VERSION;
+    ret->manager_ctx = this;
+    ret->deleter = +[](DLManagedTensorVersioned *dl) {
+      TensorObj *self = static_cast<TensorObj *>(dl->manager_ctx);
+      ::mlc::base::DecRef(&self->_mlc_header);
+      delete dl;
+    };
+    ret->flags = 0;
+    ret->dl_tensor = this->tensor;
+    return ret;
+  }
+
   ::mlc::Str __str__() const {
     std::ostringstream oss;
     oss << "<mlc.Tensor";
@@ -174,6 +199,9 @@ struct Tensor : public ObjectRef {
   explicit Tensor(DLManagedTensor *tensor) : Tensor(Tensor::New(tensor)) {}
   static Tensor FromBytes(const Str &source) { return Tensor(TensorObj::FromBytes(source)); }
   static Tensor FromBase64(const Str &source) { return Tensor(TensorObj::FromBase64(source)); }
+  static Tensor Empty(const std::vector<int64_t> &shape, DLDataType dtype, DLDevice device = DLDevice{kDLCPU, 0}) {
+    return Tensor(TensorObj::Empty(UList(shape.begin(), shape.end()), dtype, device));
+  }
 
   const void *data() const { return this->get()->tensor.data; }
   DLDevice device() const { return this->get()->tensor.device; }
@@ -0,0 +1,194 @@
+#ifndef MLC_CORE_TYPED_LIST_H_
+#define MLC_CORE_TYPED_LIST_H_
+
+#include "./list.h"
+#include "./object.h"
+#include "./typing.h"
+#include <cstring>
+#include <new>
+#include <sstream>
+
+namespace mlc {
+
+struct TypedListObj : public MLCTypedList {
+  template <typename T> static DLDataType DTypeOf() {
+    if constexpr (std::is_same_v<T, bool>) {
+      return ::mlc::base::DType::Bool();
+    } else if constexpr (std::is_same_v<T, int64_t>) {
+      return ::mlc::base::DType::Int(64);
+    } else if constexpr (std::is_same_v<T, double>) {
+      return ::mlc::base::DType::Float(64);
+    } else {
+      static_assert(std::is_same_v<T, void>, "TypedList only supports `bool`, `int64_t` and `double`");
+    }
+  }
+
+  explicit TypedListObj(DLDataType dtype) : MLCTypedList{} {
+    this->capacity = 0;
+    this->size = 0;
+    this->data = nullptr;
+    this->dtype = CheckDType(dtype);
+    this->num_exports = 0;
+  }
+  explicit TypedListObj(DLDataType dtype, int64_t size, const void *src) : TypedListObj(dtype) {
+    this->Resize(size);
+    if (src != nullptr && size > 0) {
+      std::memcpy(this->data, src, size * this->ElemSize());
+    }
+  }
+  TypedListObj(const TypedListObj &other) : TypedListObj(other.dtype, other.size, other.data) {}
+  ~TypedListObj() { ::mlc::base::PODArrayFinally finally{this->data}; }
+
+  static DLDataType CheckDType(DLDataType dtype) {
+    using ::mlc::base::DType;
+    if (DType::Equal(dtype, DType::Int(64)) || DType::Equal(dtype, DType::Float(64)) ||
+        DType::Equal(dtype, DType::Bool())) {
+      return dtype;
+    }
+    MLC_THROW(TypeError) << "TypedList only supports `int64`, `float64` and `bool`, but got: " << DType::Str(dtype);
+    MLC_UNREACHABLE();
+  }
+
+  MLC_INLINE int32_t ElemSize() const { return ::mlc::base::DType::Size(this->dtype); }
+  MLC_INLINE int64_t NumBytes() const { return this->size * this->ElemSize(); }
+  template <typename T> MLC_INLINE bool Is() const { return ::mlc::base::DType::Equal(this->dtype, DTypeOf<T>()); }
+  template <typename T> MLC_INLINE T *DataAs() {
+    if (!this->Is<T>()) {
+      MLC_THROW(TypeError) << "TypedList of dtype `" << ::mlc::base::DType::Str(this->dtype)
+                           << "` cannot be viewed as `" << ::mlc::base::DType::Str(DTypeOf<T>()) << "`";
+    }
+    return static_cast<T *>(this->data);
+  }
+  template <typename T> MLC_INLINE const T *DataAs() const { return const_cast<TypedListObj *>(this)->DataAs<T>(); }
+
+  void Reserve(int64_t new_capacity) {
+    if (this->num_exports > 0) {
+      MLC_THROW(BufferError) << "Existing exports of data: TypedList cannot be resized";
+    }
+    if (new_capacity <= this->capacity) {
+      return;
+    }
+    // Element sizes are powers of two, so rounding up the capacity below keeps its byte size within the limit
+    constexpr int64_t kMaxNumBytes = int64_t{1} << 62;
+    if (new_capacity > kMaxNumBytes / this->ElemSize()) {
+      MLC_THROW(ValueError) << "TypedList capacity is too large: " << new_capacity;
+    }
+    new_capacity = static_cast<int64_t>(::mlc::base::BitCeil(static_cast<uint64_t>(new_capacity)));
+    ::mlc::base::PODArray new_data(std::malloc(new_capacity * this->ElemSize()), std::free);
+    if (new_data == nullptr) {
+      throw std::bad_alloc();
+    }
+    if (this->size > 0) {
+      std::memcpy(new_data.get(), this->data, this->NumBytes());
+    }
+    ::mlc::base::PODArraySwapOut(&new_data, &this->data);
+    this->capacity = new_capacity;
+  }
+
+  void Resize(int64_t new_size) {
+    if (new_size > this->size) {
+      this->Reserve(new_size);
+      std::memset(static_cast<uint8_t *>(this->data) + this->NumBytes(), 0, (new_size - this->size) * this->ElemSize());
+    }
+    this->size = new_size;
+  }
+
+  Any At(int64_t i) const {
+    ::mlc::core::ListBase::ListRangeCheck(i, i + 1, this->size);
+    if (this->Is<int64_t>()) {
+      return static_cast<const int64_t *>(this->data)[i];
+    } else if (this->Is<double>()) {
+      return static_cast<const double *>(this->data)[i];
+    } else {
+      return static_cast<const uint8_t *>(this->data)[i] != 0;
+    }
+  }
+
+  void SetItem(int64_t i, AnyView value) {
+    ::mlc::core::ListBase::ListRangeCheck(i, i + 1, this->size);
+    this->StoreAt(i, value);
+  }
+
+  void Append(AnyView value) {
+    this->Reserve(this->size + 1);
+    this->StoreAt(this->size++, value);
+  }
+
+  UList ToUList() const {
+    UList ret;
+    ret.reserve(this->size);
+    for (int64_t i = 0; i < this->size; ++i) {
+      ret.push_back(this->At(i));
+    }
+    return ret;
+  }
+
+  std::string __str__() const {
+    std::ostringstream os;
+    os << "TypedList[" << ::mlc::base::DType::Str(this->dtype) << "](";
+    for (int64_t i = 0; i < this->size; ++i) {
+      if (i > 0) {
+        os << ", ";
+      }
+      os << this->At(i);
+    }
+    os << ')';
+    return os.str();
+  }
+
+  MLC_DEF_STATIC_TYPE(MLC_EXPORTS, TypedListObj, Object, MLCTypeIndex::kMLCTypedList, "mlc.core.TypedList");
+
+private:
+  void StoreAt(int64_t i, AnyView value) {
+    if (this->Is<int64_t>()) {
+      static_cast<int64_t *>(this->data)[i] = value.operator int64_t();
+    } else if (this->Is<double>()) {
+      static_cast<double *>(this->data)[i] = value.operator double();
+    } else {
+      static_cast<uint8_t *>(this->data)[i] = value.operator bool() ? 1 : 0;
+    }
+  }
+};
+
+struct TypedList : public ObjectRef {
+  template <typename T> static TypedList FromArray(const T *first, int64_t size) {
+    return TypedList(TypedListObj::DTypeOf<T>(), size, first);
+  }
+  static TypedList FromUList(UList source, DLDataType dtype) {
+    TypedList ret(dtype);
+    ret->Reserve(source.size());
+    for (const Any &e : source) {
+      ret->Append(e);
+    }
+    return ret;
+  }
+  MLC_INLINE static void FromAnyTuple(int32_t num_args, const AnyView *args, Any *ret) {
+    if (num_args < 1) {
+      MLC_THROW(TypeError) << "TypedList.__init__ expects its first argument to be `dtype`";
+    }
+    TypedList list(args[0].operator DLDataType());
+    list->Reserve(num_args - 1);
+    for (int32_t i = 1; i < num_args; ++i) {
+      list->Append(args[i]);
+    }
+    *ret = std::move(list);
+  }
+  MLC_DEF_OBJ_REF(MLC_EXPORTS, TypedList, TypedListObj, ObjectRef)
+      .Field("capacity", &MLCTypedList::capacity, /*frozen=*/true)
+      .Field("size", &MLCTypedList::size, /*frozen=*/true)
+      .Field("data", &MLCTypedList::data, /*frozen=*/true)
+      .Field("dtype", &MLCTypedList::dtype, /*frozen=*/true)
+      .StaticFn("__init__", FromAnyTuple)
+      .StaticFn("_from_list", FromUList)
+      .MemFn("__str__", &TypedListObj::__str__)
+      .MemFn("__iter_at__", &TypedListObj::At)
+      .MemFn("__setitem__", &TypedListObj::SetItem)
+      .MemFn("_append", &TypedListObj::Append)
+      .MemFn("_to_list", &TypedListObj::ToUList);
+  explicit TypedList(DLDataType dtype) : TypedList(TypedList::New(dtype)) {}
+  explicit TypedList(DLDataType dtype, int64_t size, const void *src) : TypedList(TypedList::New(dtype, size, src)) {}
+};
+
+} // namespace mlc
+
+#endif // MLC_CORE_TYPED_LIST_H_
@@ -5,9 +5,13 @@
 #include "./list.h"
 #include "./object.h"
 #include "mlc/c_api.h"
+#include <algorithm>
+#include <cstdint>
 #include <functional>
 #include <mlc/base/all.h>
+#include <type_traits>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace mlc {
@@ -184,132 +188,272 @@ template <typename Visitor> inline void VisitStructure(Object *root, MLCTypeInfo
   }
 }
 
-inline void TopoVisit(Object *root, std::function<void(Object *object, MLCTypeInfo *type_info)> pre_visit,
-                      std::function<void(Object *object, MLCTypeInfo *type_info)> on_visit) {
-  struct TopoInfo {
+// Scratch space of `TopoVisit` and `TopoVisitLevels`. Passing the same instance to repeated traversals reuses its
+// buffers instead of reallocating them. An instance must not be shared by nested or concurrent traversals.
+struct TopoVisitScratch {
+  struct Node {
     Object *obj;
     MLCTypeInfo *type_info;
     int32_t topo_deps;
-    std::vector<TopoInfo *> topo_parents;
   };
-  struct TopoState {
-    std::vector<std::unique_ptr<TopoInfo>> obj_list;
-    std::unordered_map<const Object *, int32_t> obj2index;
 
-    void TrackObject(TopoInfo *parent, Object *child) {
-      TopoInfo *child_info = [this](Object *obj) -> TopoInfo * {
-        if (auto it = obj2index.find(obj); it != obj2index.end()) {
-          return obj_list[it->second].get();
-        }
-        int32_t obj_index = static_cast<int32_t>(obj_list.size());
-        obj2index[obj] = obj_index;
-        obj_list.push_back(std::make_unique<TopoInfo>());
-        TopoInfo *info = obj_list.back().get();
-        info->obj = obj;
-        info->type_info = Lib::GetTypeInfo(obj->GetTypeIndex());
-        info->topo_deps = 0;
-        return info;
-      }(child);
-      if (parent) {
-        parent->topo_deps += 1;
-        child_info->topo_parents.push_back(parent);
+  void Clear() {
+    this->nodes.clear();
+    this->edges.clear();
+    this->parent_offsets.clear();
+    this->parents.clear();
+    this->stack.clear();
+    std::fill(this->table.begin(), this->table.end(), TableEntry{nullptr, 0});
+  }
+
+  // Returns the index of `obj` in `nodes`, appending it if not yet tracked
+  int32_t Track(Object *obj) {
+    if ((this->nodes.size() + 1) * 2 > this->table.size()) {
+      this->Rehash(std::max<size_t>(this->table.size() * 2, 64));
+    }
+    size_t mask = this->table.size() - 1;
+    for (size_t i = Hash(obj) & mask;; i = (i + 1) & mask) {
+      TableEntry &entry = this->table[i];
+      if (entry.first == obj) {
+        return entry.second;
+      }
+      if (entry.first == nullptr) {
+        int32_t index = static_cast<int32_t>(this->nodes.size());
+        entry = {obj, index};
+        this->nodes.push_back(Node{obj, Lib::GetTypeInfo(obj->GetTypeIndex()), 0});
+        return index;
       }
     }
-  };
+  }
 
-  struct FieldExtractor {
-    MLC_INLINE void operator()(MLCTypeField *, const Any *any) {
-      if (any->type_index >= kMLCStaticObjectBegin) {
-        state->TrackObject(current, any->operator Object *());
-      }
+  // Lays out `edges` as CSR, where the parents of node `i` are `parents[parent_offsets[i], parent_offsets[i + 1])`
+  // in the order their edges were added
+  void BuildParents() {
+    size_t num_nodes = this->nodes.size();
+    this->parent_offsets.assign(num_nodes + 1, 0);
+    for (const auto &[child, parent] : this->edges) {
+      ++this->parent_offsets[child + 1];
     }
-    MLC_INLINE void operator()(MLCTypeField *, ObjectRef *obj) {
-      if (Object *v = obj->get()) {
-        state->TrackObject(current, v);
-      }
+    for (size_t i = 0; i < num_nodes; ++i) {
+      this->parent_offsets[i + 1] += this->parent_offsets[i];
+    }
+    this->parents.resize(this->edges.size());
+    this->stack.assign(this->parent_offsets.begin(), this->parent_offsets.end() - 1);
+    for (const auto &[child, parent] : this->edges) {
+      this->parents[this->stack[child]++] = parent;
     }
-    MLC_INLINE void operator()(MLCTypeField *, Optional<ObjectRef> *opt) {
-      if (Object *v = opt->get()) {
-        state->TrackObject(current, v);
+    this->stack.clear();
+  }
+
+  std::vector<Node> nodes;
+  std::vector<std::pair<int32_t, int32_t>> edges; // (child, parent)
+  std::vector<int32_t> parent_offsets;
+  std::vector<int32_t> parents;
+  std::vector<int32_t> stack;
+
+private:
+  using TableEntry = std::pair<const Object *, int32_t>;
+
+  static size_t Hash(const Object *obj) {
+    uint64_t v = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(obj)) * 0x9E3779B97F4A7C15ULL;
+    return static_cast<size_t>(v >> 16);
+  }
+
+  void Rehash(size_t capacity) {
+    this->table.assign(capacity, TableEntry{nullptr, 0});
+    size_t mask = capacity - 1;
+    for (size_t index = 0; index < this->nodes.size(); ++index) {
+      size_t i = Hash(this->nodes[index].obj) & mask;
+      while (this->table[i].first != nullptr) {
+        i = (i + 1) & mask;
       }
+      this->table[i] = {this->nodes[index].obj, static_cast<int32_t>(index)};
     }
-    MLC_INLINE void operator()(MLCTypeField *, Optional<bool> *) {}
-    MLC_INLINE void operator()(MLCTypeField *, Optional<int64_t> *) {}
-    MLC_INLINE void operator()(MLCTypeField *, Optional<double> *) {}
-    MLC_INLINE void operator()(MLCTypeField *, Optional<DLDevice> *) {}
-    MLC_INLINE void operator()(MLCTypeField *, Optional<DLDataType> *) {}
-    MLC_INLINE void operator()(MLCTypeField *, bool *) {}
-    MLC_INLINE void operator()(MLCTypeField *, int8_t *) {}
-    MLC_INLINE void operator()(MLCTypeField *, int16_t *) {}
-    MLC_INLINE void operator()(MLCTypeField *, int32_t *) {}
-    MLC_INLINE void operator()(MLCTypeField *, int64_t *) {}
-    MLC_INLINE void operator()(MLCTypeField *, float *) {}
-    MLC_INLINE void operator()(MLCTypeField *, double *) {}
-    MLC_INLINE void operator()(MLCTypeField *, DLDataType *) {}
-    MLC_INLINE void operator()(MLCTypeField *, DLDevice *) {}
-    MLC_INLINE void operator()(MLCTypeField *, Optional<void *> *) {}
-    MLC_INLINE void operator()(MLCTypeField *, void **) {}
-    MLC_INLINE void operator()(MLCTypeField *, const char **) {}
+  }
 
-    TopoState *state;
-    TopoInfo *current;
-  };
+  std::vector<TableEntry> table;
+};
 
-  TopoState state;
-  // Step 1. Build dependency graph
-  state.TrackObject(nullptr, root);
-  for (size_t i = 0; i < state.obj_list.size(); ++i) {
-    TopoInfo *current = state.obj_list[i].get();
-    if (pre_visit) {
-      pre_visit(current->obj, current->type_info);
+namespace topo_details {
+
+struct FieldExtractor {
+  MLC_INLINE void operator()(MLCTypeField *, const Any *any) {
+    if (any->type_index >= kMLCStaticObjectBegin) {
+      Track(any->operator Object *());
     }
-    if (UListObj *list = current->obj->as<UListObj>()) {
+  }
+  MLC_INLINE void operator()(MLCTypeField *, ObjectRef *obj) {
+    if (Object *v = obj->get()) {
+      Track(v);
+    }
+  }
+  MLC_INLINE void operator()(MLCTypeField *, Optional<ObjectRef> *opt) {
+    if (Object *v = opt->get()) {
+      Track(v);
+    }
+  }
+  MLC_INLINE void operator()(MLCTypeField *, Optional<bool> *) {}
+  MLC_INLINE void operator()(MLCTypeField *, Optional<int64_t> *) {}
+  MLC_INLINE void operator()(MLCTypeField *, Optional<double> *) {}
+  MLC_INLINE void operator()(MLCTypeField *, Optional<DLDevice> *) {}
+  MLC_INLINE void operator()(MLCTypeField *, Optional<DLDataType> *) {}
+  MLC_INLINE void operator()(MLCTypeField *, bool *) {}
+  MLC_INLINE void operator()(MLCTypeField *, int8_t *) {}
+  MLC_INLINE void operator()(MLCTypeField *, int16_t *) {}
+  MLC_INLINE void operator()(MLCTypeField *, int32_t *) {}
+  MLC_INLINE void operator()(MLCTypeField *, int64_t *) {}
+  MLC_INLINE void operator()(MLCTypeField *, float *) {}
+  MLC_INLINE void operator()(MLCTypeField *, double *) {}
+  MLC_INLINE void operator()(MLCTypeField *, DLDataType *) {}
+  MLC_INLINE void operator()(MLCTypeField *, DLDevice *) {}
+  MLC_INLINE void operator()(MLCTypeField *, Optional<void *> *) {}
+  MLC_INLINE void operator()(MLCTypeField *, void **) {}
+  MLC_INLINE void operator()(MLCTypeField *, const char **) {}
+
+  MLC_INLINE void Track(Object *child) {
+    int32_t child_index = scratch->Track(child);
+    scratch->nodes[current].topo_deps += 1;
+    scratch->edges.emplace_back(child_index, current);
+  }
+
+  TopoVisitScratch *scratch;
+  int32_t current;
+};
+
+// Accepts `nullptr`, an empty `std::function` or function pointer to mean "no callback"
+template <typename F> MLC_INLINE bool HasCallback(const F &f) {
+  if constexpr (std::is_same_v<F, std::nullptr_t>) {
+    return false;
+  } else if constexpr (std::is_constructible_v<bool, const F &>) {
+    return static_cast<bool>(f);
+  } else {
+    return true;
+  }
+}
+
+template <typename PreVisit> inline void BuildTopoGraph(Object *root, PreVisit &pre_visit, TopoVisitScratch *scratch) {
+  scratch->Clear();
+  scratch->Track(root);
+  bool has_pre_visit = HasCallback(pre_visit);
+  // `nodes` grows while being scanned, so it is addressed by index rather than by reference
+  for (int32_t i = 0; i < static_cast<int32_t>(scratch->nodes.size()); ++i) {
+    Object *obj = scratch->nodes[i].obj;
+    MLCTypeInfo *type_info = scratch->nodes[i].type_info;
+    if constexpr (!std::is_same_v<std::decay_t<PreVisit>, std::nullptr_t>) {
+      if (has_pre_visit) {
+        pre_visit(obj, type_info);
+      }
+    }
+    FieldExtractor extractor{scratch, i};
+    if (UListObj *list = obj->as<UListObj>()) {
       for (Any any : *list) {
-        FieldExtractor{&state, current}(nullptr, &any);
+        extractor(nullptr, &any);
       }
-    } else if (UDictObj *dict = current->obj->as<UDictObj>()) {
+    } else if (UDictObj *dict = obj->as<UDictObj>()) {
       for (auto &kv : *dict) {
-        FieldExtractor{&state, current}(nullptr, &kv.first);
-        FieldExtractor{&state, current}(nullptr, &kv.second);
+        extractor(nullptr, &kv.first);
+        extractor(nullptr, &kv.second);
       }
     } else {
-      int32_t type_index = current->type_info->type_index;
+      int32_t type_index = type_info->type_index;
       if (type_index == kMLCStr || type_index == kMLCFunc || type_index == kMLCError || type_index == kMLCOpaque ||
-          type_index == kMLCTensor) {
+          type_index == kMLCTensor || type_index == kMLCTypedList) {
         continue;
       } else {
-        VisitFields(current->obj, current->type_info, FieldExtractor{&state, current});
+        VisitFields(obj, type_info, extractor);
       }
     }
   }
-  if (on_visit == nullptr) {
-    // No need to topo-visit because `on_visit` is not provided
+  scratch->BuildParents();
+}
+
+} // namespace topo_details
+
+// Visits every object reachable from `root`, calling `pre_visit` in BFS order and then `on_visit` on each object after
+// all objects it refers to. Either callback can be `nullptr`.
+template <typename PreVisit, typename OnVisit>
+inline void TopoVisit(Object *root, PreVisit &&pre_visit, OnVisit &&on_visit, TopoVisitScratch *scratch = nullptr) {
+  TopoVisitScratch local_scratch;
+  if (scratch == nullptr) {
+    scratch = &local_scratch;
+  }
+  // Step 1. Build dependency graph
+  topo_details::BuildTopoGraph(root, pre_visit, scratch);
+  if constexpr (std::is_same_v<std::decay_t<OnVisit>, std::nullptr_t>) {
     return;
+  } else {
+    if (!topo_details::HasCallback(on_visit)) {
+      // No need to topo-visit because `on_visit` is not provided
+      return;
+    }
+    std::vector<TopoVisitScratch::Node> &nodes = scratch->nodes;
+    std::vector<int32_t> &stack = scratch->stack;
+    // Step 2. Enqueue nodes with no dependency
+    stack.reserve(nodes.size());
+    for (int32_t i = 0; i < static_cast<int32_t>(nodes.size()); ++i) {
+      if (nodes[i].topo_deps == 0) {
+        stack.push_back(i);
+      }
+    }
+    // Step 3. Traverse the graph by topological order
+    size_t num_objects = 0;
+    for (; !stack.empty(); ++num_objects) {
+      int32_t current = stack.back();
+      stack.pop_back();
+      // Step 3.1. Visit object
+      on_visit(nodes[current].obj, nodes[current].type_info);
+      // Step 3.2. Decrease the dependency count of topo_parents
+      for (int32_t j = scratch->parent_offsets[current]; j < scratch->parent_offsets[current + 1]; ++j) {
+        int32_t parent = scratch->parents[j];
+        if (--nodes[parent].topo_deps == 0) {
+          stack.push_back(parent);
+        }
+      }
+    }
+    if (num_objects != nodes.size()) {
+      MLC_THROW(ValueError) << "Can't topo-visit objects with circular dependency";
+    }
+  }
+}
+
+// Objects in the same level only depend on objects in earlier levels, so `on_level` may process them in any order,
+// including concurrently.
+template <typename PreVisit, typename OnLevel>
+inline void TopoVisitLevels(Object *root, PreVisit &&pre_visit, OnLevel &&on_level,
+                            TopoVisitScratch *scratch = nullptr) {
+  TopoVisitScratch local_scratch;
+  if (scratch == nullptr) {
+    scratch = &local_scratch;
   }
-  // Step 2. Enqueue nodes with no dependency
-  std::vector<TopoInfo *> stack;
-  stack.reserve(state.obj_list.size());
-  for (size_t i = 0; i < state.obj_list.size(); ++i) {
-    TopoInfo *current = state.obj_list[i].get();
-    if (current->topo_deps == 0) {
-      stack.push_back(current);
+  // Step 1. Build dependency graph
+  topo_details::BuildTopoGraph(root, pre_visit, scratch);
+  std::vector<TopoVisitScratch::Node> &nodes = scratch->nodes;
+  // Step 2. Collect nodes with no dependency as the first level. `stack` holds the current level followed by the next.
+  std::vector<int32_t> &frontier = scratch->stack;
+  for (int32_t i = 0; i < static_cast<int32_t>(nodes.size()); ++i) {
+    if (nodes[i].topo_deps == 0) {
+      frontier.push_back(i);
     }
   }
-  // Step 3. Traverse the graph by topological order
+  // Step 3. Peel off one level at a time
+  std::vector<std::pair<Object *, MLCTypeInfo *>> level;
   size_t num_objects = 0;
-  for (; !stack.empty(); ++num_objects) {
-    TopoInfo *current = stack.back();
-    stack.pop_back();
-    // Step 3.1. Visit object
-    on_visit(current->obj, current->type_info);
-    // Step 3.2. Decrease the dependency count of topo_parents
-    for (TopoInfo *parent : current->topo_parents) {
-      if (--parent->topo_deps == 0) {
-        stack.push_back(parent);
+  for (size_t begin = 0, end = frontier.size(); begin < end; begin = end, end = frontier.size()) {
+    level.clear();
+    for (size_t i = begin; i < end; ++i) {
+      int32_t current = frontier[i];
+      level.emplace_back(nodes[current].obj, nodes[current].type_info);
+      for (int32_t j = scratch->parent_offsets[current]; j < scratch->parent_offsets[current + 1]; ++j) {
+        int32_t parent = scratch->parents[j];
+        if (--nodes[parent].topo_deps == 0) {
+          frontier.push_back(parent);
+        }
       }
     }
+    num_objects += level.size();
+    on_level(level);
   }
-  if (num_objects != state.obj_list.size()) {
+  if (num_objects != nodes.size()) {
     MLC_THROW(ValueError) << "Can't topo-visit objects with circular dependency";
   }
 }
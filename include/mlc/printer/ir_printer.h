@@ -191,14 +191,14 @@ struct IRPrinter : public ObjectRef {
       : IRPrinter(IRPrinter::New(cfg, obj2info, defined_names, frames, frame_vars)) {}
 }; // struct IRPrinter
 
-inline Str ToPython(const ObjectRef &obj, const PrinterConfig &cfg) {
+inline Node ToDoc(const ObjectRef &obj, const PrinterConfig &cfg) {
   IRPrinter printer(cfg);
   DefaultFrame frame;
   printer->FramePush(frame);
   Node ret = ::mlc::Lib::IRPrint(obj, printer, ObjectPath::Root());
   printer->FramePop();
   if (frame->stmts->empty()) {
-    return ret->ToPython(cfg);
+    return ret;
   }
   if (const auto *block = ret.as<StmtBlockObj>()) {
     // TODO: support List::insert by iterator
@@ -210,8 +210,15 @@ inline Str ToPython(const ObjectRef &obj, const PrinterConfig &cfg) {
   } else {
     MLC_THROW(ValueError) << "Unsupported type: " << ret;
   }
-  ret = StmtBlock(mlc::List<ObjectPath>{}, Optional<Str>{}, frame->stmts);
-  return ret->ToPython(cfg);
+  return StmtBlock(mlc::List<ObjectPath>{}, Optional<Str>{}, frame->stmts);
+}
+
+inline Str ToPython(const ObjectRef &obj, const PrinterConfig &cfg) { return ToDoc(obj, cfg)->ToPython(cfg); }
+
+// Prints `obj` like `ToPython`, but passes the text to `write` piece by piece instead of returning it as a whole
+inline void ToPythonStream(const ObjectRef &obj, const PrinterConfig &cfg, Func write) {
+  static auto func = ::mlc::base::GetGlobalFuncCall<3>("mlc.printer.DocToPythonScriptStream");
+  func({ToDoc(obj, cfg), cfg, write});
 }
 
 } // namespace printer
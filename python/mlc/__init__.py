@@ -10,9 +10,13 @@ from .core import (
     Object,
     ObjectPath,
     Opaque,
+    StructuralInternTable,
     Tensor,
+    TypedList,
     build_info,
     json_loads,
+    set_identity_cache_enabled,
+    set_traceback_enabled,
     typing,
 )
 from .dataclasses import PyClass, c_class, py_class
@@ -26,16 +26,21 @@ from .base import (
     dtype_normalize,
 )
 from .core import (  # type: ignore[import-not-found]
+    FieldAccessor,
     device_as_pair,
     dtype_as_triple,
     dtype_from_triple,
     error_get_info,
     error_pycode_fake,
+    fields_gather,
+    fields_scatter,
     func_call,
     func_get,
     func_init,
     func_register,
+    identity_cache_set_enabled,
     make_mlc_init,
+    make_py_class_init,
     opaque_init,
     register_opauqe_type,
     str_c2py,
@@ -49,17 +54,19 @@ from .core import (  # type: ignore[import-not-found]
     tensor_shape,
     tensor_strides,
     tensor_to_dlpack,
+    tensor_to_dlpack_versioned,
     type_add_method,
     type_cast,
     type_create,
     type_create_instance,
-    type_field_get_accessor,
+    type_field_init_accessor,
     type_index2cached_py_type_info,
     type_index2type_methods,
     type_key2py_type_info,
     type_register_fields,
     type_register_structure,
     type_table,
+    typed_list_buffer,
 )
 
 LIB: _ctypes.CDLL = _core.LIB
@@ -38,6 +38,7 @@ TLS.str2exc = {}
 TLS.str2bytes = {}
 ERR_KIND2CLS = {
     "AttributeError": AttributeError,
+    "BufferError": BufferError,
     "IndexError": IndexError,
     "KeyError": KeyError,
     "TypeError": TypeError,
@@ -174,6 +175,7 @@ class TypeField:
     ty: PyAny | mlc_typing.Type
     getter: Callable[[typing.Any], typing.Any] | None = None
     setter: Callable[[typing.Any, typing.Any], None] | None = None
+    accessor: typing.Any = None  # `core.FieldAccessor`, the data descriptor installed on the class
 
 
 @dataclasses.dataclass(eq=False, **_DATACLASS_SLOTS)
@@ -364,25 +366,8 @@ class MetaNoSlots(type):
         return super().__new__(cls, name, bases, dict)
 
 
-def attach_field(
-    cls: type,
-    name: str,
-    getter: typing.Callable[[typing.Any], typing.Any] | None,
-    setter: typing.Callable[[typing.Any, typing.Any], None] | None,
-    frozen: bool,
-) -> None:
-    def fget(this: typing.Any, _name: str = name) -> typing.Any:
-        return getter(this)  # type: ignore[misc]
-
-    def fset(this: typing.Any, value: typing.Any, _name: str = name) -> None:
-        setter(this, value)  # type: ignore[misc]
-
-    prop = property(
-        fget=fget if getter else None,
-        fset=fset if (not frozen) and setter else None,
-        doc=f"{cls.__module__}.{cls.__qualname__}.{name}",
-    )
-    setattr(cls, name, prop)
+def attach_field(cls: type, field: TypeField) -> None:
+    setattr(cls, field.name, field.accessor)
 
 
 def attach_method(
@@ -439,13 +424,7 @@ def c_class_core(type_key: str) -> Callable[[type[ClsType]], type[ClsType]]:
         # Step 2. Attach fields
         setattr(type_cls, "_mlc_type_info", type_info)
         for field in type_info.fields:
-            attach_field(
-                cls=type_cls,
-                name=field.name,
-                getter=field.getter,
-                setter=field.setter,
-                frozen=field.frozen,
-            )
+            attach_field(type_cls, field)
 
         # Step 4. Attach methods
         method: TypeMethod
@@ -1,11 +1,18 @@
 # cython: language_level=3
 import ctypes
 import itertools
+cimport cython
+from libcpp.unordered_map cimport unordered_map
 from libcpp.vector cimport vector
 from libc.stdint cimport int8_t, int16_t, int32_t, int64_t, uint8_t, uint16_t, uint32_t, uint64_t
 from libc.stdlib cimport malloc, free
+from libc.string cimport memcpy
 from numbers import Integral, Number
 from cpython cimport Py_DECREF, Py_INCREF, PyCapsule_IsValid, PyCapsule_GetPointer, PyCapsule_SetName, PyCapsule_New
+from cpython cimport PyObject
+from cython.operator cimport dereference
+from cpython.buffer cimport PyObject_CheckBuffer, PyBUF_FORMAT, PyBUF_ND, PyBUF_STRIDES, PyBUF_WRITABLE
+from cpython.bytearray cimport PyByteArray_AS_STRING
 from . import base
 
 Ptr = base.Ptr
@@ -77,6 +84,7 @@ cdef extern from "mlc/c_api.h" nogil:
         kMLCStr = 1005
         kMLCTensor = 1006
         kMLCOpaque = 1007
+        kMLCTypedList = 1008
         kMLCCoreEnd = 1100
         # }
         # kMLCTyping [1100: 1200) {
@@ -157,6 +165,14 @@ cdef extern from "mlc/c_api.h" nogil:
         MLCDeleterType handle_deleter
         const char* opaque_type_name
 
+    ctypedef struct MLCTypedList:
+        MLCAny _mlc_header
+        int64_t capacity
+        int64_t size
+        void* data
+        DLDataType dtype
+        int64_t num_exports
+
     ctypedef struct MLCTypingAny:
         MLCAny _mlc_header
 
@@ -307,6 +323,7 @@ cdef inline void _check_error_from(int32_t err_code, MLCAny* c_ret):
 
 # Section 4. Definition MLC's fundamental types: `PyAny` and `Str`
 
+@cython.freelist(64)
 cdef class PyAny:
     cdef MLCAny _mlc_any
     __slots__ = ()
@@ -315,6 +332,8 @@ cdef class PyAny:
         self._mlc_any = _MLCAnyNone()
 
     def __dealloc__(self):
+        if not _IDENTITY_CACHE.empty():
+            _identity_cache_erase(self)
         _check_error(_C_AnyDecRef(&self._mlc_any))
 
     def __init__(self):
@@ -344,19 +363,23 @@ cdef class PyAny:
         return (base.new_object, (type(self),), self.__getstate__())
 
     def __getstate__(self):
-        return {"mlc_json": func_call(_SERIALIZE, (self,))}
+        return {"mlc_json": func_call(_SERIALIZE, (self, False))}
 
     def __setstate__(self, state):
         cdef PyAny ret = func_call(_DESERIALIZE, (state["mlc_json"], ))
         cdef MLCAny tmp = self._mlc_any
+        _identity_cache_erase(self)
+        _identity_cache_erase(ret)
         self._mlc_any = ret._mlc_any
         ret._mlc_any = tmp
 
-    def _mlc_json(self):
-        return func_call(_SERIALIZE, (self,))
+    def _mlc_json(self, bint dedup_tensor_content = False):
+        return func_call(_SERIALIZE, (self, dedup_tensor_content))
 
     def _mlc_swap(self, PyAny other):
         cdef MLCAny tmp = self._mlc_any
+        _identity_cache_erase(self)
+        _identity_cache_erase(other)
         self._mlc_any = other._mlc_any
         other._mlc_any = tmp
 
@@ -365,16 +388,20 @@ cdef class PyAny:
         return func_call(_DESERIALIZE, (mlc_json,))
 
     @staticmethod
-    def _mlc_eq_s(PyAny lhs, PyAny rhs, bint bind_free_vars, bint assert_mode) -> bool:
-        return bool(func_call(_STRUCUTRAL_EQUAL, (lhs, rhs, bind_free_vars, assert_mode)))
+    def _mlc_eq_s(PyAny lhs, PyAny rhs, bint bind_free_vars, bint assert_mode, bint tensor_content = False) -> bool:
+        return bool(func_call(_STRUCUTRAL_EQUAL, (lhs, rhs, bind_free_vars, assert_mode, tensor_content)))
+
+    @staticmethod
+    def _mlc_eq_s_fail_reason(PyAny lhs, PyAny rhs, bint bind_free_vars, bint tensor_content = False):
+        return func_call(_STRUCUTRAL_EQUAL_FAIL_REASON, (lhs, rhs, bind_free_vars, tensor_content))
 
     @staticmethod
-    def _mlc_eq_s_fail_reason(PyAny lhs, PyAny rhs, bint bind_free_vars):
-        return func_call(_STRUCUTRAL_EQUAL_FAIL_REASON, (lhs, rhs, bind_free_vars))
+    def _mlc_diff_s(PyAny lhs, PyAny rhs, bint bind_free_vars, bint tensor_content, int64_t max_diffs):
+        return func_call(_STRUCTURAL_DIFF, (lhs, rhs, bind_free_vars, tensor_content, max_diffs))
 
     @staticmethod
-    def _mlc_hash_s(PyAny x) -> object:
-        cdef object ret = func_call(_STRUCUTRAL_HASH, (x,))
+    def _mlc_hash_s(PyAny x, bint tensor_content = False) -> object:
+        cdef object ret = func_call(_STRUCUTRAL_HASH, (x, tensor_content))
         if ret < 0:
             ret += 2 ** 63
         return ret
@@ -384,8 +411,8 @@ cdef class PyAny:
         return func_call(_COPY_SHALLOW, (x,))
 
     @staticmethod
-    def _mlc_copy_deep(PyAny x) -> PyAny:
-        return func_call(_COPY_DEEP, (x,))
+    def _mlc_copy_deep(PyAny x, bint share_frozen=False, int32_t num_threads=1) -> PyAny:
+        return func_call(_COPY_DEEP, (x, share_frozen, num_threads))
 
     @staticmethod
     def _mlc_copy_replace(*args) -> PyAny:
@@ -524,6 +551,37 @@ cdef inline uint64_t _addr_from_ptr(object ptr):
 
 # Section 5. Conversion MLCAny => Python objects
 
+cdef inline void _identity_cache_erase(PyAny x):
+    # Called before a wrapper is freed or swapped, as the cache holds borrowed references
+    cdef unordered_map[void*, PyObject*].iterator it
+    if x._mlc_any.type_index < kMLCStaticObjectBegin:
+        return
+    it = _IDENTITY_CACHE.find(<void*>x._mlc_any.v.v_obj)
+    if it != _IDENTITY_CACHE.end() and dereference(it).second == <PyObject*>x:
+        _IDENTITY_CACHE.erase(it)
+
+cdef inline object _any_c2py_object(MLCAny x, object type_cls, bint inc_ref):
+    # `PyAny.__new__` only allocates the wrapper, and unlike `type_cls.__new__`, never runs
+    # `__new__` overridden in Python, e.g. by `py_class`, which creates another MLC object
+    cdef PyAny ret
+    cdef unordered_map[void*, PyObject*].iterator it
+    if _IDENTITY_CACHE_ENABLED:
+        it = _IDENTITY_CACHE.find(<void*>x.v.v_obj)
+        if it != _IDENTITY_CACHE.end():
+            ret = <PyAny>(dereference(it).second)
+            if type(ret) is type_cls and ret._mlc_any.v.v_obj == x.v.v_obj:
+                if not inc_ref:
+                    _check_error(_C_AnyDecRef(&x))
+                return ret
+    ret = PyAny.__new__(type_cls)
+    ret._mlc_any = x
+    if inc_ref:
+        _check_error(_C_AnyIncRef(&x))
+    if _IDENTITY_CACHE_ENABLED:
+        _IDENTITY_CACHE[<void*>x.v.v_obj] = <PyObject*>ret
+    return ret
+
+
 cdef inline object _any_c2py_no_inc_ref(const MLCAny x):
     cdef int32_t type_index = x.type_index
     cdef MLCStr* mlc_str = NULL
@@ -549,10 +607,7 @@ cdef inline object _any_c2py_no_inc_ref(const MLCAny x):
     elif type_index == kMLCOpaque:
         return <object>((<MLCOpaque*>(x.v.v_obj)).handle)
     elif (type_cls := _list_get(TYPE_INDEX_TO_INFO, type_index)) is not None:
-        type_cls = type_cls.type_cls
-        any_ret = type_cls.__new__(type_cls)
-        any_ret._mlc_any = x
-        return any_ret
+        return _any_c2py_object(x, type_cls.type_cls, False)
     raise ValueError(f"MLC does not recognize type: {type_index}")
 
 cdef inline object _any_c2py_inc_ref(MLCAny x):
@@ -581,26 +636,22 @@ cdef inline object _any_c2py_inc_ref(MLCAny x):
     elif type_index == kMLCOpaque:
         return <object>((<MLCOpaque*>(x.v.v_obj)).handle)
     elif (type_cls := _list_get(TYPE_INDEX_TO_INFO, type_index)) is not None:
-        type_cls = type_cls.type_cls
-        any_ret = type_cls.__new__(type_cls)
-        any_ret._mlc_any = x
-        _check_error(_C_AnyIncRef(&x))
-        return any_ret
+        return _any_c2py_object(x, type_cls.type_cls, True)
     raise ValueError(f"MLC does not recognize type: {type_index}")
 
 cdef inline PyAny _pyany_no_inc_ref(MLCAny x):
-    cdef PyAny ret = PyAny()
+    cdef PyAny ret = PyAny.__new__(PyAny)
     ret._mlc_any = x
     return ret
 
 cdef inline PyAny _pyany_inc_ref(MLCAny x):
-    cdef PyAny ret = PyAny()
+    cdef PyAny ret = PyAny.__new__(PyAny)
     ret._mlc_any = x
     _check_error(_C_AnyIncRef(&ret._mlc_any))
     return ret
 
 cdef inline PyAny _pyany_from_opaque(object x):
-    cdef PyAny ret = PyAny()
+    cdef PyAny ret = PyAny.__new__(PyAny)
     cdef bytes type_name = str_py2c(type(x).__module__ + "." + type(x).__name__)
     cdef MLCAny args[3]
     if not isinstance(x, _OPAQUE_TYPES):
@@ -625,7 +676,7 @@ cdef inline PyAny _pyany_from_dlpack(object array):
     # 1) only `stream=None` is assumed;
     # 2) method `array.__dlpack_device__` is never invoked
     # 3) flag `copy=False` is always passed to `array.__dlpack__`
-    cdef PyAny ret = PyAny()
+    cdef PyAny ret = PyAny.__new__(PyAny)
     cdef MLCAny args[1]
     cdef object capsule = None
 
@@ -663,6 +714,9 @@ cdef inline MLCAny _any_py2c(object x, list temporary_storage):
         y = _MLCAnyNone()
     elif isinstance(x, PyAny):
         y = (<PyAny>x)._mlc_any
+        if _IDENTITY_CACHE_ENABLED and y.type_index >= kMLCStaticObjectBegin and type(x) is not PyAny:
+            if _IDENTITY_CACHE.count(<void*>y.v.v_obj) == 0:
+                _IDENTITY_CACHE[<void*>y.v.v_obj] = <PyObject*>x
     elif isinstance(x, Str):
         y = (<Str>x)._mlc_any
     elif isinstance(x, bool):
@@ -753,7 +807,7 @@ cdef inline int32_t _func_safe_call_impl(
     return 0
 
 cdef inline PyAny _pyany_from_func(object py_func):
-    cdef PyAny ret = PyAny()
+    cdef PyAny ret = PyAny.__new__(PyAny)
     Py_INCREF(py_func)
     _check_error(_C_FuncCreate(<void*>(py_func), _pyobj_deleter, _func_safe_call, &ret._mlc_any))
     return ret
@@ -824,7 +878,7 @@ cdef inline object _type_info_c2py(MLCTypeInfo* c_info):
             frozen=bool(fields_ptr.frozen),
             ty=_pyany_inc_ref(_MLCAnyObj(fields_ptr.ty)),
         )
-        type_field.getter, type_field.setter = _type_field_accessor(type_field)
+        _type_field_init_accessor(type_field)
         fields.append(type_field)
         fields_ptr += 1
     ret = base.TypeInfo(
@@ -844,7 +898,7 @@ cdef inline MLCVTableHandle _vtable_get_global(bytes key):
     return ret
 
 cdef inline PyAny _vtable_get_func(MLCVTableHandle vtable, int32_t type_index, int32_t allow_ancestor):
-    cdef PyAny ret = PyAny()
+    cdef PyAny ret = PyAny.__new__(PyAny)
     _check_error(_C_VTableGetFunc(vtable, type_index, allow_ancestor, &ret._mlc_any))
     if ret._mlc_any.type_index == kMLCNone:
         raise ValueError(f"Cannot find function for type: {str_c2py(_type_index2c_type_info(type_index).type_key)}")
@@ -1161,104 +1215,243 @@ cdef inline TypeChecker _type_checker_from_ty(MLCAny* ty):
     else:
         raise ValueError(f"Unsupported type index: {ty.type_index}")
 
-cdef tuple _type_field_accessor(object type_field: base.TypeField):
-    cdef int64_t offset = type_field.offset
+cdef enum FieldKind:
+    kFieldAny = 0
+    kFieldObj = 1
+    kFieldBool = 2
+    kFieldInt8 = 3
+    kFieldInt16 = 4
+    kFieldInt32 = 5
+    kFieldInt64 = 6
+    kFieldFloat32 = 7
+    kFieldFloat64 = 8
+    kFieldPtr = 9
+    kFieldDType = 10
+    kFieldDevice = 11
+    kFieldRawStr = 12
+    kFieldOptBool = 13
+    kFieldOptInt = 14
+    kFieldOptFloat = 15
+    kFieldOptPtr = 16
+    kFieldOptDType = 17
+    kFieldOptDevice = 18
+
+cdef class FieldAccessor:
+    """Data descriptor of a field at a fixed byte offset of an MLC object.
+
+    Layout and type checking are resolved once, when the descriptor is created, so attribute access
+    is a switch over `kind` instead of a Python closure call.
+    """
+    cdef readonly str name
+    cdef int64_t offset
+    cdef FieldKind kind
+    cdef bint frozen
+    cdef TypeChecker checker
+
+    def __get__(self, object obj, object objtype):
+        if obj is None:
+            return self
+        return self._get(<PyAny?>obj)
+
+    def __set__(self, object obj, object value):
+        if self.frozen or self.kind == kFieldRawStr:
+            raise AttributeError(f"property '{self.name}' of '{type(obj).__name__}' object has no setter")
+        self._set(<PyAny?>obj, value)
+
+    def __delete__(self, object obj):
+        raise AttributeError(f"property '{self.name}' of '{type(obj).__name__}' object has no deleter")
+
+    def get(self, PyAny obj):
+        return self._get(obj)
+
+    def set(self, PyAny obj, object value):
+        self._set(obj, value)
+
+    cdef inline char* _addr(self, PyAny obj):
+        return <char*>(obj._mlc_any.v.v_obj) + self.offset
+
+    cdef object _get(self, PyAny obj):
+        cdef char* addr = self._addr(obj)
+        cdef FieldKind kind = self.kind
+        cdef MLCAny* ptr
+        cdef MLCBoxedPOD* boxed
+        if kind == kFieldAny:
+            return _any_c2py_inc_ref((<MLCAny*>addr)[0])
+        elif kind == kFieldObj:
+            ptr = (<MLCAny**>addr)[0]
+            return _any_c2py_inc_ref(_MLCAnyObj(ptr)) if ptr != NULL else None
+        elif kind == kFieldBool:
+            return (<uint8_t*>addr)[0] != 0
+        elif kind == kFieldInt8:
+            return (<int8_t*>addr)[0]
+        elif kind == kFieldInt16:
+            return (<int16_t*>addr)[0]
+        elif kind == kFieldInt32:
+            return (<int32_t*>addr)[0]
+        elif kind == kFieldInt64:
+            return (<int64_t*>addr)[0]
+        elif kind == kFieldFloat32:
+            return (<float*>addr)[0]
+        elif kind == kFieldFloat64:
+            return (<double*>addr)[0]
+        elif kind == kFieldPtr:
+            return _Ptr((<void**>addr)[0])
+        elif kind == kFieldDType:
+            return _DataType((<DLDataType*>addr)[0])
+        elif kind == kFieldDevice:
+            return _Device((<DLDevice*>addr)[0])
+        elif kind == kFieldRawStr:
+            return str_c2py((<char**>addr)[0])
+        boxed = (<MLCBoxedPOD**>addr)[0]
+        if boxed == NULL:
+            return None
+        elif kind == kFieldOptBool:
+            return boxed.data.v_bool
+        elif kind == kFieldOptInt:
+            return boxed.data.v_int64
+        elif kind == kFieldOptFloat:
+            return boxed.data.v_float64
+        elif kind == kFieldOptPtr:
+            return _Ptr(boxed.data.v_ptr)
+        elif kind == kFieldOptDType:
+            return _DataType(boxed.data.v_dtype)
+        elif kind == kFieldOptDevice:
+            return _Device(boxed.data.v_device)
+        raise ValueError(f"Unsupported field kind: {kind}")
+
+    cdef void _set(self, PyAny obj, object value) except *:
+        cdef char* addr = self._addr(obj)
+        cdef FieldKind kind = self.kind
+        cdef MLCAny save
+        cdef MLCAny ret = _MLCAnyNone()
+        cdef MLCAny[2] args
+        cdef list temporary_storage
+        if kind == kFieldAny:
+            save = (<MLCAny*>addr)[0]
+            temporary_storage = []
+            (<MLCAny*>addr)[0] = _any_py2c(value, temporary_storage)
+            _check_error(_C_AnyInplaceViewToOwned(<MLCAny*>addr))
+            _check_error(_C_AnyDecRef(&save))
+        elif kind == kFieldObj:
+            save = _MLCAnyNone() if (<MLCAny**>addr)[0] == NULL else _MLCAnyObj((<MLCAny**>addr)[0])
+            temporary_storage = []
+            ret = _type_checker_call(self.checker, value, temporary_storage)
+            if ret.type_index == kMLCNone:
+                (<MLCAny**>addr)[0] = NULL
+            elif ret.type_index >= kMLCStaticObjectBegin:
+                (<MLCAny**>addr)[0] = ret.v.v_obj
+                _check_error(_C_AnyIncRef(&ret))
+            else:
+                raise TypeError(f"Unexpected type index: {ret.type_index}")
+            _check_error(_C_AnyDecRef(&save))
+        elif kind == kFieldBool:
+            if not isinstance(value, bool):
+                raise TypeError(f"Expected `bool`, but got: {value}")
+            (<uint8_t*>addr)[0] = <bint?>(value)
+        elif kind == kFieldInt8:
+            (<int8_t*>addr)[0] = value
+        elif kind == kFieldInt16:
+            (<int16_t*>addr)[0] = value
+        elif kind == kFieldInt32:
+            (<int32_t*>addr)[0] = value
+        elif kind == kFieldInt64:
+            (<int64_t*>addr)[0] = value
+        elif kind == kFieldFloat32:
+            (<float*>addr)[0] = <double>value
+        elif kind == kFieldFloat64:
+            (<double*>addr)[0] = value
+        elif kind == kFieldPtr:
+            (<void**>addr)[0] = <void*>_addr_from_ptr(value)
+        elif kind == kFieldDType:
+            _func_call_impl(_DTYPE_INIT, (base.dtype_normalize(value), ), &ret)
+            (<DLDataType*>addr)[0] = ret.v.v_dtype
+        elif kind == kFieldDevice:
+            _func_call_impl(_DEVICE_INIT, (base.device_normalize(value), ), &ret)
+            (<DLDevice*>addr)[0] = ret.v.v_device
+        else:
+            # Optional POD fields are boxed, and (re)allocated by the `__new_ref__` of the boxed type
+            args[0] = _MLCAnyPtr(<uint64_t>addr)
+            args[1] = _MLCAnyNone()
+            if kind == kFieldOptBool:
+                if value is not None:
+                    if not isinstance(value, bool):
+                        raise TypeError(f"Expected `bool`, but got: {value}")
+                    args[1] = _MLCAnyBool(value)
+                _func_call_impl_with_c_args(_BOOL_NEW, 2, args, &ret)
+            elif kind == kFieldOptInt:
+                if value is not None:
+                    args[1] = _MLCAnyInt(<int64_t?>value)
+                _func_call_impl_with_c_args(_INT_NEW, 2, args, &ret)
+            elif kind == kFieldOptFloat:
+                if value is not None:
+                    args[1] = _MLCAnyFloat(<double?>value)
+                _func_call_impl_with_c_args(_FLOAT_NEW, 2, args, &ret)
+            elif kind == kFieldOptPtr:
+                if value is not None:
+                    args[1] = _MLCAnyPtr(_addr_from_ptr(value))
+                _func_call_impl_with_c_args(_PTR_NEW, 2, args, &ret)
+            elif kind == kFieldOptDType:
+                if value is not None:
+                    _func_call_impl(_DTYPE_INIT, (base.dtype_normalize(value), ), &args[1])
+                _func_call_impl_with_c_args(_DTYPE_NEW, 2, args, &ret)
+            elif kind == kFieldOptDevice:
+                if value is not None:
+                    _func_call_impl(_DEVICE_INIT, (base.device_normalize(value), ), &args[1])
+                _func_call_impl_with_c_args(_DEVICE_NEW, 2, args, &ret)
+            else:
+                raise ValueError(f"Unsupported field kind: {kind}")
+
+cdef FieldAccessor _type_field_accessor(object type_field: base.TypeField):
+    cdef FieldAccessor ret = FieldAccessor.__new__(FieldAccessor)
     cdef int32_t num_bytes = type_field.num_bytes
     cdef MLCAny* ty = (<PyAny?>(type_field.ty))._mlc_any.v.v_obj
     cdef int32_t idx = -1
-    cdef TypeChecker checker
+    cdef int32_t type_index
+    ret.name = type_field.name
+    ret.offset = type_field.offset
+    ret.frozen = type_field.frozen
     if (ty.type_index, num_bytes) == (kMLCTypingAny, sizeof(MLCAny)):
-        def f(PyAny self): return _any_c2py_inc_ref((<MLCAny*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0])
-        def g(PyAny self, object value):  # no-cython-lint
-            cdef MLCAny* addr = <MLCAny*>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-            cdef MLCAny save = addr[0]
-            cdef list temporary_storage = []
-            addr[0] = _any_py2c(value, temporary_storage)
-            _check_error(_C_AnyInplaceViewToOwned(addr))
-            _check_error(_C_AnyDecRef(&save))
-        return f, g
+        ret.kind = kFieldAny
+        return ret
     elif ty.type_index in (kMLCTypingAtomic, kMLCTypingList, kMLCTypingDict):
         idx = (<MLCTypingAtomic*>ty).type_index if ty.type_index == kMLCTypingAtomic else -1
         if (idx == -1 or idx >= kMLCStaticObjectBegin) and num_bytes == sizeof(MLCAny*):
-            def f(PyAny self):
-                cdef MLCAny* ptr = (<MLCAny**>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0]
-                return _any_c2py_inc_ref(_MLCAnyObj(ptr)) if ptr != NULL else None
-            checker = _type_checker_from_ty(ty)
-            def g(PyAny self, object value):  # no-cython-lint
-                cdef MLCAny **addr = <MLCAny**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny save = _MLCAnyNone() if addr[0] == NULL else _MLCAnyObj(addr[0])
-                cdef list temporary_storage = []
-                cdef MLCAny ret
-                try:
-                    ret = _type_checker_call(checker, value, temporary_storage)
-                    if ret.type_index == kMLCNone:
-                        addr[0] = NULL
-                    elif ret.type_index >= kMLCStaticObjectBegin:
-                        addr[0] = ret.v.v_obj
-                        _check_error(_C_AnyIncRef(&ret))
-                    else:
-                        raise TypeError(f"Unexpected type index: {ret.type_index}")
-                else:
-                    _check_error(_C_AnyDecRef(&save))
-            return f, g
+            ret.kind = kFieldObj
+            ret.checker = _type_checker_from_ty(ty)
+            return ret
         elif (idx, num_bytes) == (kMLCBool, 1):
-            def f(PyAny self):
-                cdef uint8_t* ret = <uint8_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                return ret[0] != 0
-
-            def g(PyAny self, value):
-                cdef uint8_t* ret = <uint8_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                if not isinstance(value, bool):
-                    raise TypeError(f"Expected `bool`, but got: {value}")
-                ret[0] = <bint?>(value)
-            return f, g
+            ret.kind = kFieldBool
+            return ret
         elif (idx, num_bytes) == (kMLCInt, 1):
-            def f(PyAny self): return (<int8_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0]
-            def g(PyAny self, int8_t value): (<int8_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0] = value
-            return f, g
+            ret.kind = kFieldInt8
+            return ret
         elif (idx, num_bytes) == (kMLCInt, 2):
-            def f(PyAny self): return (<int16_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0]
-            def g(PyAny self, int16_t value): (<int16_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0] = value
-            return f, g
+            ret.kind = kFieldInt16
+            return ret
         elif (idx, num_bytes) == (kMLCInt, 4):
-            def f(PyAny self): return (<int32_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0]
-            def g(PyAny self, int32_t value): (<int32_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0] = value
-            return f, g
+            ret.kind = kFieldInt32
+            return ret
         elif (idx, num_bytes) == (kMLCInt, 8):
-            def f(PyAny self): return (<int64_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0]
-            def g(PyAny self, int64_t value): (<int64_t*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0] = value
-            return f, g
+            ret.kind = kFieldInt64
+            return ret
         elif (idx, num_bytes) == (kMLCFloat, 4):
-            def f(PyAny self): return (<float*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0]
-            def g(PyAny self, double value): (<float*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0] = value
-            return f, g
+            ret.kind = kFieldFloat32
+            return ret
         elif (idx, num_bytes) == (kMLCFloat, 8):
-            def f(PyAny self): return (<double*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0]
-            def g(PyAny self, double value): (<double*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0] = value
-            return f, g
+            ret.kind = kFieldFloat64
+            return ret
         elif (idx, num_bytes) == (kMLCPtr, sizeof(void*)):
-            def f(PyAny self): return _Ptr((<void**>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0])
-            def g(PyAny self, object ptr): (<void**>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0] = <void*>_addr_from_ptr(ptr)  # no-cython-lint
-            return f, g
+            ret.kind = kFieldPtr
+            return ret
         elif (idx, num_bytes) == (kMLCDataType, sizeof(DLDataType)):
-            def f(PyAny self): return _DataType((<DLDataType*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0])
-            def g(PyAny self, object dtype):  # no-cython-lint
-                cdef DLDataType* addr = <DLDataType*>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny ret = _MLCAnyNone()
-                _func_call_impl(_DTYPE_INIT, (base.dtype_normalize(dtype), ), &ret)
-                addr[0] = ret.v.v_dtype
-            return f, g
+            ret.kind = kFieldDType
+            return ret
         elif (idx, num_bytes) == (kMLCDevice, sizeof(DLDevice)):
-            def f(PyAny self): return _Device((<DLDevice*>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0])
-            def g(PyAny self, object device):  # no-cython-lint
-                cdef DLDevice* addr = <DLDevice*>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny ret = _MLCAnyNone()
-                _func_call_impl(_DEVICE_INIT, (base.device_normalize(device), ), &ret)
-                addr[0] = ret.v.v_device
-            return f, g
+            ret.kind = kFieldDevice
+            return ret
         elif (idx, num_bytes) == (kMLCRawStr, sizeof(char*)):
-            def f(PyAny self): return str_c2py((<char**>(<uint64_t>(self._mlc_any.v.v_obj) + offset))[0])
-            return f, None  # raw str is always read-only
+            ret.kind = kFieldRawStr  # raw str is always read-only
+            return ret
     elif ty.type_index in (kMLCTypingPtr, kMLCTypingOptional) and num_bytes == sizeof(MLCAny*):
         if ty.type_index == kMLCTypingPtr:
             ty = (<MLCTypingPtr*>ty).ty.ptr
@@ -1278,116 +1471,82 @@ cdef tuple _type_field_accessor(object type_field: base.TypeField):
         else:
             raise ValueError(f"Unsupported type field: {type_field.ty.__str__()}")
         if type_index >= kMLCStaticObjectBegin:
-            def f(PyAny self):
-                cdef MLCAny** addr = <MLCAny**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny* ptr = addr[0]
-                return _any_c2py_inc_ref(_MLCAnyObj(ptr)) if ptr != NULL else None
-            checker = TypeCheckerOptional(_type_checker_from_ty(ty)).get()
-            def g(PyAny self, object value):  # no-cython-lint
-                cdef MLCAny **addr = <MLCAny**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny save = _MLCAnyNone() if addr[0] == NULL else _MLCAnyObj(addr[0])
-                cdef list temporary_storage = []
-                cdef MLCAny ret
-                try:
-                    ret = _type_checker_call(checker, value, temporary_storage)
-                    if ret.type_index == kMLCNone:
-                        addr[0] = NULL
-                    elif ret.type_index >= kMLCStaticObjectBegin:
-                        addr[0] = ret.v.v_obj
-                        _check_error(_C_AnyIncRef(&ret))
-                    else:
-                        raise TypeError(f"Unexpected type index: {ret.type_index}")
-                else:
-                    _check_error(_C_AnyDecRef(&save))
-            return f, g
+            ret.kind = kFieldObj
+            ret.checker = TypeCheckerOptional(_type_checker_from_ty(ty)).get()
+            return ret
         elif type_index == kMLCBool:
-            def f(PyAny self):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCBoxedPOD* ptr = addr[0]
-                return ptr.data.v_bool if ptr != NULL else None
-
-            def g(PyAny self, value):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny ret = _MLCAnyNone()
-                cdef MLCAny[2] args = [_MLCAnyPtr(<uint64_t>addr), _MLCAnyNone()]
-                if value is not None:
-                    if not isinstance(value, bool):
-                        raise TypeError(f"Expected `bool`, but got: {value}")
-                    args[1] = _MLCAnyBool(value)
-                _func_call_impl_with_c_args(_BOOL_NEW, 2, args, &ret)
-            return f, g
+            ret.kind = kFieldOptBool
+            return ret
         elif type_index == kMLCInt:
-            def f(PyAny self):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCBoxedPOD* ptr = addr[0]
-                return ptr.data.v_int64 if ptr != NULL else None
-
-            def g(PyAny self, object value):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny ret = _MLCAnyNone()
-                cdef MLCAny[2] args = [_MLCAnyPtr(<uint64_t>addr), _MLCAnyNone()]
-                if value is not None:
-                    args[1] = _MLCAnyInt(<int64_t?>value)
-                _func_call_impl_with_c_args(_INT_NEW, 2, args, &ret)
-            return f, g
+            ret.kind = kFieldOptInt
+            return ret
         elif type_index == kMLCFloat:
-            def f(PyAny self):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCBoxedPOD* ptr = addr[0]
-                return ptr.data.v_float64 if ptr != NULL else None
-
-            def g(PyAny self, object value):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny ret = _MLCAnyNone()
-                cdef MLCAny[2] args = [_MLCAnyPtr(<uint64_t>addr), _MLCAnyNone()]
-                if value is not None:
-                    args[1] = _MLCAnyFloat(<double?>value)
-                _func_call_impl_with_c_args(_FLOAT_NEW, 2, args, &ret)
-            return f, g
+            ret.kind = kFieldOptFloat
+            return ret
         elif type_index == kMLCPtr:
-            def f(PyAny self):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCBoxedPOD* ptr = addr[0]
-                return _Ptr(ptr.data.v_ptr) if ptr != NULL else None
-
-            def g(PyAny self, object value):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny ret = _MLCAnyNone()
-                cdef MLCAny[2] args = [_MLCAnyPtr(<uint64_t>addr), _MLCAnyNone()]
-                if value is not None:
-                    args[1] = _MLCAnyPtr(_addr_from_ptr(value))
-                _func_call_impl_with_c_args(_PTR_NEW, 2, args, &ret)
-            return f, g
+            ret.kind = kFieldOptPtr
+            return ret
         elif type_index == kMLCDataType:
-            def f(PyAny self):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCBoxedPOD* ptr = addr[0]
-                return _DataType(ptr.data.v_dtype) if ptr != NULL else None
-
-            def g(PyAny self, object value):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny[2] args = [_MLCAnyPtr(<uint64_t>addr), _MLCAnyNone()]
-                cdef MLCAny ret = _MLCAnyNone()
-                if value is not None:
-                    _func_call_impl(_DTYPE_INIT, (base.dtype_normalize(value), ), &args[1])
-                _func_call_impl_with_c_args(_DTYPE_NEW, 2, args, &ret)
-            return f, g
+            ret.kind = kFieldOptDType
+            return ret
         elif type_index == kMLCDevice:
-            def f(PyAny self):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCBoxedPOD* ptr = addr[0]
-                return _Device(ptr.data.v_device) if ptr != NULL else None
-
-            def g(PyAny self, object value):
-                cdef MLCBoxedPOD** addr = <MLCBoxedPOD**>(<uint64_t>(self._mlc_any.v.v_obj) + offset)
-                cdef MLCAny ret = _MLCAnyNone()
-                cdef MLCAny[2] args = [_MLCAnyPtr(<uint64_t>addr), _MLCAnyNone()]
-                if value is not None:
-                    _func_call_impl(_DEVICE_INIT, (base.device_normalize(value), ), &args[1])
-                _func_call_impl_with_c_args(_DEVICE_NEW, 2, args, &ret)
-            return f, g
+            ret.kind = kFieldOptDevice
+            return ret
     raise ValueError(f"Unsupported {num_bytes}-byte type field: {type_field.ty.__str__()}")
 
+cdef void _type_field_init_accessor(object type_field: base.TypeField) except *:
+    cdef FieldAccessor accessor = _type_field_accessor(type_field)
+    type_field.accessor = accessor
+    type_field.getter = accessor.get
+    type_field.setter = None if accessor.kind == kFieldRawStr else accessor.set
+
+cdef FieldAccessor _type_index2field_accessor(int32_t type_index, str name):
+    cdef object type_info = _type_index2py_type_info(type_index)
+    for type_field in type_info.fields:
+        if type_field.name == name:
+            return <FieldAccessor?>(type_field.accessor)
+    raise AttributeError(f"'{type_info.type_key}' object has no field '{name}'")
+
+cdef inline int32_t _obj2type_index(object obj) except? -1:
+    cdef int32_t type_index = (<PyAny?>obj)._mlc_any.type_index
+    if type_index < kMLCStaticObjectBegin:
+        raise TypeError(f"Expected an MLC object, but got: {type(obj).__name__}")
+    return type_index
+
+cdef inline FieldAccessor _type_index2field_accessor_cached(int32_t type_index, str name, dict cache):
+    cdef FieldAccessor ret
+    if (ret := cache.get(type_index)) is None:
+        ret = cache[type_index] = _type_index2field_accessor(type_index, name)
+    return ret
+
+cdef inline int32_t _field_kind_num_bytes(FieldKind kind):
+    if kind == kFieldBool or kind == kFieldInt8:
+        return 1
+    elif kind == kFieldInt16:
+        return 2
+    elif kind == kFieldInt32 or kind == kFieldFloat32:
+        return 4
+    elif kind == kFieldInt64 or kind == kFieldFloat64:
+        return 8
+    return 0
+
+cdef inline str _field_kind_format(FieldKind kind):
+    if kind == kFieldBool:
+        return "?"
+    elif kind == kFieldInt8:
+        return "b"
+    elif kind == kFieldInt16:
+        return "h"
+    elif kind == kFieldInt32:
+        return "i"
+    elif kind == kFieldInt64:
+        return "q"
+    elif kind == kFieldFloat32:
+        return "f"
+    elif kind == kFieldFloat64:
+        return "d"
+    return None
+
 
 # Section 11. Interface with Python
 
@@ -1479,6 +1638,61 @@ cpdef object tensor_to_dlpack(PyAny self):
     cdef DLManagedTensor* dl_managed_tensor = <DLManagedTensor*><uint64_t>(func_call(_TENSOR_TO_DLPACK, (self,)).value)
     return PyCapsule_New(dl_managed_tensor, _DLPACK_CAPSULE_NAME, pycapsule_deleter)
 
+cpdef object tensor_to_dlpack_versioned(PyAny self):
+    cdef DLManagedTensorVersioned* dl_managed_tensor = <DLManagedTensorVersioned*><uint64_t>(func_call(_TENSOR_TO_DLPACK_VER, (self,)).value)  # no-cython-lint
+    return PyCapsule_New(dl_managed_tensor, _DLPACK_CAPSULE_NAME_VER, pycapsule_deleter)
+
+cdef class TypedListBuffer:
+    # N.B. The exported buffer aliases the list storage, so the list keeps a
+    # count of live exports and refuses to grow while any is alive. The view
+    # is read-only, as writes through it would bypass the list's own checks.
+    cdef PyAny owner
+    cdef Py_ssize_t shape[1]
+    cdef Py_ssize_t strides[1]
+
+    def __getbuffer__(self, Py_buffer *buffer, int flags):
+        cdef MLCTypedList* tlist = <MLCTypedList*>(self.owner._mlc_any.v.v_obj)
+        cdef DLDataType dtype = tlist.dtype
+        cdef Py_ssize_t itemsize = 1 if dtype.bits == 1 else dtype.bits // 8
+        if flags & PyBUF_WRITABLE:
+            raise BufferError("TypedList buffer is read-only")
+        if not flags & PyBUF_FORMAT:
+            buffer.format = NULL
+        elif dtype.code == 0:  # kDLInt
+            buffer.format = "q"
+        elif dtype.code == 2:  # kDLFloat
+            buffer.format = "d"
+        else:
+            buffer.format = "?"
+        self.shape[0] = tlist.size
+        self.strides[0] = itemsize
+        buffer.buf = tlist.data
+        buffer.internal = NULL
+        buffer.itemsize = itemsize
+        buffer.len = tlist.size * itemsize
+        buffer.ndim = 1
+        buffer.obj = self
+        buffer.readonly = 1
+        buffer.shape = NULL
+        buffer.strides = NULL
+        buffer.suboffsets = NULL
+        if flags & PyBUF_ND:
+            buffer.shape = self.shape
+        if (flags & PyBUF_STRIDES) == PyBUF_STRIDES:
+            buffer.strides = self.strides
+        tlist.num_exports += 1
+
+    def __releasebuffer__(self, Py_buffer *buffer):
+        cdef MLCTypedList* tlist = <MLCTypedList*>(self.owner._mlc_any.v.v_obj)
+        tlist.num_exports -= 1
+
+cpdef object typed_list_buffer(PyAny self):
+    cdef TypedListBuffer ret = TypedListBuffer()
+    if self._mlc_any.type_index != kMLCTypedList:
+        raise TypeError(f"Expected MLC typed list, got: {self}")
+    ret.owner = self
+    return memoryview(ret)
+
 cpdef void func_register(str name, bint allow_override, object func):
     cdef PyAny mlc_func = _pyany_from_func(func)
     _check_error(_C_FuncSetGlobal(NULL, str_py2c(name), mlc_func._mlc_any, allow_override))
@@ -1489,7 +1703,7 @@ cpdef object func_get(str name):
     return _any_c2py_no_inc_ref(c_ret)
 
 cpdef PyAny func_get_untyped(str name):
-    cdef PyAny ret = PyAny()
+    cdef PyAny ret = PyAny.__new__(PyAny)
     _check_error(_C_FuncGetGlobal(NULL, str_py2c(name), &ret._mlc_any))
     return ret
 
@@ -1531,9 +1745,78 @@ cpdef object type_cast(PyAny typing_obj, object value):
     cdef MLCAny ret = _type_checker_call(checker, value, temporary_storage)
     return _any_c2py_inc_ref(ret)
 
-cpdef tuple type_field_get_accessor(object type_field):
+cpdef void type_field_init_accessor(object type_field) except *:
     assert isinstance(type_field, base.TypeField)
-    return _type_field_accessor(type_field)
+    _type_field_init_accessor(type_field)
+
+cpdef object fields_gather(object objs, str name, bint as_buffer):
+    # The accessor is resolved when the type index changes, and is otherwise reused across objects
+    cdef list items = objs if isinstance(objs, list) else list(objs)
+    cdef Py_ssize_t num_objs = len(items)
+    cdef Py_ssize_t i
+    cdef dict cache = {}
+    cdef int32_t type_index
+    cdef int32_t last_type_index = -1
+    cdef FieldAccessor accessor = None
+    cdef FieldKind kind
+    cdef int32_t num_bytes = 0
+    cdef list ret
+    cdef bytearray buffer
+    cdef char* data = NULL
+    if not as_buffer:
+        ret = [None] * num_objs
+        for i in range(num_objs):
+            obj = items[i]
+            if (type_index := _obj2type_index(obj)) != last_type_index:
+                accessor = _type_index2field_accessor_cached(type_index, name, cache)
+                last_type_index = type_index
+            ret[i] = accessor._get(<PyAny>obj)
+        return ret
+    for i in range(num_objs):
+        obj = items[i]
+        if (type_index := _obj2type_index(obj)) != last_type_index:
+            accessor = _type_index2field_accessor_cached(type_index, name, cache)
+            last_type_index = type_index
+            if data == NULL:
+                kind = accessor.kind
+                if (num_bytes := _field_kind_num_bytes(kind)) == 0:
+                    raise TypeError(
+                        f"Field `{name}` is not a bool, int or float field, and cannot be gathered into a buffer"
+                    )
+                buffer = bytearray(num_objs * num_bytes)
+                data = PyByteArray_AS_STRING(buffer)
+            elif accessor.kind != kind:
+                raise TypeError(f"Field `{name}` of `{type(obj).__name__}` differs in type from the first object")
+        memcpy(data + i * num_bytes, accessor._addr(<PyAny>obj), num_bytes)
+    if data == NULL:
+        return memoryview(bytearray())
+    return memoryview(buffer).cast(_field_kind_format(kind))
+
+cpdef void fields_scatter(object objs, str name, object values) except *:
+    cdef list items = objs if isinstance(objs, list) else list(objs)
+    cdef Py_ssize_t i
+    cdef dict cache = {}
+    cdef int32_t type_index
+    cdef int32_t last_type_index = -1
+    cdef FieldAccessor accessor = None
+    cdef memoryview view
+    if PyObject_CheckBuffer(values):
+        view = memoryview(values)
+        if view.ndim != 1:
+            raise ValueError(f"Expected a 1-dimensional buffer of values, but got {view.ndim} dimensions")
+        values = view.tolist()
+    elif not isinstance(values, (list, tuple)):
+        values = list(values)
+    if len(values) != len(items):
+        raise ValueError(f"Got {len(items)} objects but {len(values)} values")
+    for i in range(len(items)):
+        obj = items[i]
+        if (type_index := _obj2type_index(obj)) != last_type_index:
+            accessor = _type_index2field_accessor_cached(type_index, name, cache)
+            last_type_index = type_index
+            if accessor.frozen or accessor.kind == kFieldRawStr:
+                raise AttributeError(f"property '{name}' of '{type(obj).__name__}' object has no setter")
+        accessor._set(<PyAny>obj, values[i])
 
 cpdef PyAny type_create_instance(object cls, int32_t type_index, int32_t num_bytes):
     cdef PyAny self = PyAny.__new__(cls)
@@ -1614,6 +1897,14 @@ cpdef list type_index2type_methods(int32_t type_index):
 cpdef object type_index2cached_py_type_info(int32_t type_index):
     return TYPE_INDEX_TO_INFO[type_index]
 
+cpdef bint identity_cache_set_enabled(bint enabled):
+    global _IDENTITY_CACHE_ENABLED
+    cdef bint prev = _IDENTITY_CACHE_ENABLED
+    _IDENTITY_CACHE_ENABLED = enabled
+    if not enabled:
+        _IDENTITY_CACHE.clear()
+    return prev
+
 
 def register_opauqe_type(object new_type) -> None:
     global _OPAQUE_TYPES
@@ -1621,17 +1912,17 @@ def register_opauqe_type(object new_type) -> None:
 
 
 def make_mlc_init(list fields):
-    cdef tuple _setters = tuple(field.setter for field in fields)
+    cdef tuple _accessors = tuple(<FieldAccessor?>(field.accessor) for field in fields)
 
     def _mlc_init(PyAny self, *args):
-        cdef tuple setters = _setters
+        cdef tuple accessors = _accessors
         cdef int32_t num_args = len(args)
         cdef int32_t i = 0
         cdef object e = None
-        assert num_args == len(setters)
+        assert num_args == len(accessors)
         while i < num_args:
             try:
-                setters[i](self, args[i])
+                (<FieldAccessor>accessors[i])._set(self, args[i])
             except Exception as _e:  # no-cython-lint
                 e = ValueError(f"Failed to set field `{fields[i].name}`: {str(_e)}. Got: {args[i]}")
                 e = e.with_traceback(_e.__traceback__)
@@ -1642,6 +1933,70 @@ def make_mlc_init(list fields):
     return _mlc_init
 
 
+def make_py_class_init(
+    str signature_str,
+    tuple param_names,
+    tuple param_defaults,
+    tuple field_params,
+    list fields,
+):
+    # Binds `__init__` arguments with indices precomputed from the signature, rather than
+    # `inspect.Signature.bind`. Parameter `j` is named `param_names[j]`, and when omitted, is
+    # filled by calling `param_defaults[j]`, or is required if that is None. Field `i` takes
+    # the value of parameter `field_params[i]`
+    cdef tuple _accessors = tuple(<FieldAccessor?>(field.accessor) for field in fields)
+    cdef dict _param_index = {name: j for j, name in enumerate(param_names)}
+    cdef int32_t _num_params = len(param_names)
+    cdef object _missing = base.MISSING
+
+    def _init(PyAny self, *args, **kwargs):
+        cdef tuple accessors = _accessors
+        cdef int32_t num_params = _num_params
+        cdef int32_t num_args = len(args)
+        cdef list values
+        cdef int32_t i
+        cdef int32_t j
+        cdef object e = None
+        cdef object post_init
+        try:
+            if num_args > num_params:
+                raise TypeError("too many positional arguments")
+            values = list(args)
+            if num_args < num_params:
+                values.extend([_missing] * (num_params - num_args))
+            if kwargs:
+                for name, value in kwargs.items():
+                    if (j := _param_index.get(name, -1)) < 0:
+                        raise TypeError(f"got an unexpected keyword argument '{name}'")
+                    if j < num_args:
+                        raise TypeError(f"multiple values for argument '{name}'")
+                    values[j] = value
+            for j in range(num_args, num_params):
+                if values[j] is _missing:
+                    if param_defaults[j] is None:
+                        raise TypeError(f"missing a required argument: '{param_names[j]}'")
+                    values[j] = param_defaults[j]()
+            for i in range(num_params):
+                j = field_params[i]
+                try:
+                    (<FieldAccessor>accessors[i])._set(self, values[j])
+                except Exception as _e:  # no-cython-lint
+                    raise ValueError(
+                        f"Failed to set field `{param_names[j]}`: {str(_e)}. Got: {values[j]}"
+                    ).with_traceback(_e.__traceback__)
+        except Exception as _e:  # no-cython-lint
+            e = TypeError(f"Error in `{signature_str}`: {_e}").with_traceback(_e.__traceback__)
+        if e is not None:
+            raise e
+        try:
+            post_init = self.__post_init__
+        except AttributeError:
+            pass
+        else:
+            post_init()
+
+    return _init
+
 def type_create(int32_t parent_type_index, str type_key):
     cdef MLCTypeInfo* c_info = NULL
     cdef object type_info
@@ -1675,15 +2030,20 @@ cdef const char* _DLPACK_CAPSULE_NAME_VER = "dltensor_versioned"
 cdef const char* _DLPACK_CAPSULE_NAME_VER_USED = "used_dltensor_versioned"
 
 cdef list TYPE_INDEX_TO_INFO = [None]  # mapping: (type_index: int) ==> (type_info: base.TypeInfo)
-cdef PyAny _SERIALIZE = func_get_untyped("mlc.core.JSONSerialize")  # Any -> str
+# mapping: (address of an MLC object) ==> (borrowed reference to its live Python wrapper)
+cdef unordered_map[void*, PyObject*] _IDENTITY_CACHE
+cdef bint _IDENTITY_CACHE_ENABLED = False
+cdef PyAny _SERIALIZE = func_get_untyped("mlc.core.JSONSerializeWithOptions")  # (Any, bool) -> str
 cdef PyAny _DESERIALIZE = func_get_untyped("mlc.core.JSONDeserialize")  # str -> Any
-cdef PyAny _STRUCUTRAL_EQUAL = func_get_untyped("mlc.core.StructuralEqual")
-cdef PyAny _STRUCUTRAL_HASH = func_get_untyped("mlc.core.StructuralHash")
-cdef PyAny _STRUCUTRAL_EQUAL_FAIL_REASON = func_get_untyped("mlc.core.StructuralEqualFailReason")
+cdef PyAny _STRUCUTRAL_EQUAL = func_get_untyped("mlc.core.StructuralEqualWithTensorContent")
+cdef PyAny _STRUCUTRAL_HASH = func_get_untyped("mlc.core.StructuralHashWithTensorContent")
+cdef PyAny _STRUCUTRAL_EQUAL_FAIL_REASON = func_get_untyped("mlc.core.StructuralEqualFailReasonWithTensorContent")
+cdef PyAny _STRUCTURAL_DIFF = func_get_untyped("mlc.core.StructuralDiff")
 cdef PyAny _COPY_SHALLOW = func_get_untyped("mlc.core.CopyShallow")
-cdef PyAny _COPY_DEEP = func_get_untyped("mlc.core.CopyDeep")
+cdef PyAny _COPY_DEEP = func_get_untyped("mlc.core.CopyDeepWithOptions")  # (Any, bool, int) -> Any
 cdef PyAny _COPY_REPLACE = func_get_untyped("mlc.core.CopyReplace")
 cdef PyAny _TENSOR_TO_DLPACK = func_get_untyped("mlc.core.TensorToDLPack")
+cdef PyAny _TENSOR_TO_DLPACK_VER = func_get_untyped("mlc.core.TensorToDLPackVersioned")
 
 cdef MLCVTableHandle _VTABLE_STR = _vtable_get_global(b"__str__")
 cdef MLCVTableHandle _VTABLE_ANY_TO_REF = _vtable_get_global(b"__any_to_ref__")
@@ -1,5 +1,6 @@
 from __future__ import annotations
 
+import hashlib
 import os
 import re
 import shlex
@@ -8,6 +9,7 @@ import subprocess
 import tempfile
 import warnings
 from collections.abc import Mapping, Sequence
+from concurrent.futures import ThreadPoolExecutor
 from pathlib import Path
 from types import MappingProxyType
 from typing import Any
@@ -50,11 +52,24 @@ DEFAULT_OPTIONS: Mapping[str, Sequence[str]] = {
 }
 
 
+PCH_HEADERS: Sequence[str] = ("mlc/core/all.h", "mlc/printer/all.h")
+
+
 def create_shared(
     sources: str | Path | Sequence[Path | str],
     output: str | Path,
     options: Mapping[str, Sequence[str]] = MappingProxyType(DEFAULT_OPTIONS),
+    *,
+    jobs: int | None = None,
+    precompiled_header: bool = False,
 ) -> None:
+    """Compiles `sources` into the shared library `output`.
+
+    On Linux and macOS, each source is compiled in a pool of `jobs` workers, and the objects are
+    linked in a separate step. If `precompiled_header` is True, the MLC headers are force included
+    into every source from a precompiled header built once per compiler and options. This is opt-in,
+    as the forced include comes before anything the source defines ahead of its own MLC includes.
+    """
     if not isinstance(options, Sequence):
         platform_options = options[SYSTEM]
     else:
@@ -67,6 +82,8 @@ def create_shared(
                 output=Path(output).resolve(),
                 work_dir=work_dir,
                 options=platform_options,
+                jobs=jobs,
+                precompiled_header=precompiled_header,
             )
         elif SYSTEM == "Windows":
             _windows_compile(
@@ -79,33 +96,144 @@ def create_shared(
             raise NotImplementedError(f"Unsupported platform: {SYSTEM}")
 
 
-def _linux_compile(
+def _linux_compile(  # noqa: PLR0913
     sources: list[Path],
     output: Path,
     work_dir: Path,
     options: Sequence[str],
+    *,
+    jobs: int | None,
+    precompiled_header: bool,
 ) -> None:
-    temp_output = "main.so"
-    cmd: list[str] = [
-        str(mlc_config.probe_compiler()[0]),
-        *options,
-        "-o",
-        str(temp_output),
-    ]
-    cmd.extend("-I" + str(path) for path in mlc_config.includedir())
-    cmd.extend(str(source) for source in sources)
-
+    compiler = mlc_config.probe_compiler()[0]
+    include_flags = ["-I" + str(path) for path in mlc_config.includedir()]
     exec_env: dict[str, Any] = os.environ.copy()
+    launcher: list[str] = []
     if ccache := shutil.which("ccache", mode=os.X_OK):
-        cmd.insert(0, ccache)
+        launcher.append(ccache)
         exec_env["CCACHE_COMPILERCHECK"] = "mtime"
         exec_env["CCACHE_NOHASHDIR"] = "1"
         exec_env["CCACHE_BASEDIR"] = str(work_dir)
+        exec_env["CCACHE_SLOPPINESS"] = "pch_defines,time_macros"
     else:
         warnings.warn("ccache not found")
+    pch_flags: list[str] = []
+    if precompiled_header:
+        if (
+            pch := _linux_precompiled_header(compiler, options, include_flags, exec_env)
+        ) is not None:
+            pch_flags = ["-include", str(pch)]
+            if "clang" not in compiler.name:
+                pch_flags.append("-fpch-preprocess")
+    objects = [f"_mlc_object_{i}.o" for i in range(len(sources))]
+    compile_cmds = [
+        [
+            *launcher,
+            str(compiler),
+            *options,
+            *include_flags,
+            *pch_flags,
+            "-c",
+            str(source),
+            "-o",
+            obj,
+        ]
+        for source, obj in zip(sources, objects)
+    ]
+    with ThreadPoolExecutor(max_workers=jobs or os.cpu_count() or 1) as pool:
+        for proc in pool.map(lambda cmd: _linux_run(cmd, work_dir, exec_env), compile_cmds):
+            _check_returncode(proc)
+    temp_output = "main.so"
+    _check_returncode(
+        _linux_run([str(compiler), *options, "-o", temp_output, *objects], work_dir, exec_env)
+    )
+    shutil.move(str(work_dir / temp_output), str(output))
+
 
+def _linux_precompiled_header(
+    compiler: Path,
+    options: Sequence[str],
+    include_flags: Sequence[str],
+    exec_env: dict[str, Any],
+) -> Path | None:
+    # The header is only valid for the compiler, flags and MLC headers it was built with
+    stat = compiler.stat()
+    key = hashlib.sha256(
+        "\0".join(
+            [
+                f"{compiler}:{stat.st_size}:{stat.st_mtime_ns}",
+                *options,
+                *include_flags,
+                *PCH_HEADERS,
+                *(str(_latest_mtime_ns(path)) for path in mlc_config.includedir()),
+            ]
+        ).encode("utf-8")
+    ).hexdigest()[:32]
+    pch_dir = mlc_config.cachedir() / "pch" / key
+    header = pch_dir / "mlc_pch.h"
+    binary = pch_dir / ("mlc_pch.h.pch" if "clang" in compiler.name else "mlc_pch.h.gch")
+    failure = pch_dir / "failed.log"
+    if binary.is_file():
+        return header
+    if failure.is_file():
+        return None
+    pch_dir.mkdir(parents=True, exist_ok=True)
+    # Written under unique names and renamed into place, so concurrent builds see whole files only
+    fd, temp_header = tempfile.mkstemp(dir=pch_dir, suffix=".h")
+    with os.fdopen(fd, "w", encoding="utf-8") as f:
+        f.write("".join(f"#include <{path}>\n" for path in PCH_HEADERS))
+    Path(temp_header).chmod(0o644)
+    Path(temp_header).replace(header)
+    fd, temp_binary = tempfile.mkstemp(dir=pch_dir, suffix=binary.suffix)
+    os.close(fd)
+    try:
+        cmd = [
+            str(compiler),
+            *options,
+            *include_flags,
+            "-x",
+            "c++-header",
+            str(header),
+            "-o",
+            temp_binary,
+        ]
+        cmd = [arg for arg in cmd if arg != "-shared"]
+        proc = _linux_run(cmd, pch_dir, exec_env)
+        if proc.returncode != 0:
+            # Recorded so that later builds with the same key skip the attempt and the warning
+            fd, temp_failure = tempfile.mkstemp(dir=pch_dir, suffix=".log")
+            with os.fdopen(fd, "w", encoding="utf-8") as f:
+                f.write(proc.stdout)
+            Path(temp_failure).replace(failure)
+            warnings.warn(
+                f"Failed to build precompiled header, compiling without it:\n{proc.stdout}"
+            )
+            return None
+        Path(temp_binary).chmod(0o644)
+        Path(temp_binary).replace(binary)
+    finally:
+        Path(temp_binary).unlink(missing_ok=True)
+    return header
+
+
+def _latest_mtime_ns(include_dir: Path) -> int:
+    # Unlike `Path.rglob`, `os.walk` can follow symlinked directories, which dev installs use
+    return max(
+        (
+            (Path(root) / name).stat().st_mtime_ns
+            for root, _, names in os.walk(include_dir, followlinks=True)
+            for name in names
+            if name.endswith(".h")
+        ),
+        default=0,
+    )
+
+
+def _linux_run(
+    cmd: list[str], work_dir: Path, exec_env: dict[str, Any]
+) -> subprocess.CompletedProcess[str]:
     print(f"Executing command: {shlex.join(cmd)}")
-    proc = subprocess.run(
+    return subprocess.run(
         cmd,
         stdout=subprocess.PIPE,
         stderr=subprocess.STDOUT,
@@ -114,10 +242,12 @@ def _linux_compile(
         text=True,
         check=False,
     )
+
+
+def _check_returncode(proc: subprocess.CompletedProcess[str]) -> None:
     if proc.returncode != 0:
         msg = f"Compilation error (return code {proc.returncode}):\n{proc.stdout}"
         raise RuntimeError(msg)
-    shutil.move(str(work_dir / temp_output), str(output))
 
 
 def _windows_compile(
@@ -154,9 +284,7 @@ def _windows_compile(
         check=False,
         shell=True,
     )
-    if proc.returncode != 0:
-        msg = f"Compilation error (return code {proc.returncode}):\n{proc.stdout}"
-        raise RuntimeError(msg)
+    _check_returncode(proc)
     shutil.move(str(temp_output), str(output))
 
 
@@ -1,27 +1,104 @@
 from __future__ import annotations
 
+import hashlib
+import os
 import tempfile
 from collections.abc import Mapping, Sequence
 from pathlib import Path
 from types import MappingProxyType
 
+from mlc import config as mlc_config
 from mlc._cython import DSO_SUFFIX, SYSTEM
+from mlc.core import build_info
 
 from .compiler import DEFAULT_OPTIONS, create_shared
 from .loader import load_dso
 
+_LOADED: set[str] = set()
+
 
 def jit_load(
     sources: str | Path | Sequence[Path | str],
     options: Mapping[str, Sequence[str]] = MappingProxyType(DEFAULT_OPTIONS),
+    *,
+    cache: bool = True,
+    precompiled_header: bool = False,
 ) -> None:
+    """Compiles `sources` into a shared library and loads it.
+
+    Unless `cache` is False, the library is kept in `cache_dir()` under a hash of the sources, the
+    compiler, the options and the MLC build, so later calls, including from other processes, load it
+    without recompiling. Headers included by the sources are not part of the hash.
+    `precompiled_header` is passed on to `create_shared`.
+    """
     if isinstance(options, Sequence):
-        options: dict[str, Sequence[str]] = {SYSTEM: sources}  # type: ignore[no-redef]
-    with tempfile.TemporaryDirectory() as temp_dir_str:
-        output = Path(temp_dir_str) / f"jit{DSO_SUFFIX}"
-        create_shared(
-            sources=sources,
-            output=output,
-            options=options,
+        options: dict[str, Sequence[str]] = {SYSTEM: options}  # type: ignore[no-redef]
+    if not cache:
+        with tempfile.TemporaryDirectory() as temp_dir_str:
+            output = Path(temp_dir_str) / f"jit{DSO_SUFFIX}"
+            create_shared(
+                sources=sources,
+                output=output,
+                options=options,
+                precompiled_header=precompiled_header,
+            )
+            load_dso(output)
+        return
+    key = _cache_key(sources, options[SYSTEM])
+    if key in _LOADED:
+        return
+    directory = cache_dir()
+    output = directory / f"jit_{key}{DSO_SUFFIX}"
+    if not output.is_file():
+        directory.mkdir(parents=True, exist_ok=True)
+        # Built under a unique name and renamed into place, so no process loads a partial file
+        fd, temp_output_str = tempfile.mkstemp(
+            dir=directory, prefix=f".jit_{key}_", suffix=DSO_SUFFIX
         )
-        load_dso(output)
+        os.close(fd)
+        try:
+            create_shared(
+                sources=sources,
+                output=temp_output_str,
+                options=options,
+                precompiled_header=precompiled_header,
+            )
+            Path(temp_output_str).replace(output)
+        finally:
+            Path(temp_output_str).unlink(missing_ok=True)
+    load_dso(output)
+    _LOADED.add(key)
+
+
+def cache_dir() -> Path:
+    if path := os.environ.get("MLC_JIT_CACHE_DIR"):
+        return Path(path)
+    return mlc_config.cachedir() / "jit"
+
+
+def _cache_key(sources: str | Path | Sequence[Path | str], options: Sequence[str]) -> str:
+    h = hashlib.sha256()
+
+    def _update(tag: str, data: bytes) -> None:
+        h.update(tag.encode("utf-8"))
+        h.update(len(data).to_bytes(8, "little"))
+        h.update(data)
+
+    if isinstance(sources, str) or not isinstance(sources, Sequence):
+        sources = [sources]
+    for source in sources:
+        if isinstance(source, Path) or Path(source).is_file():
+            _update("file", Path(source).read_bytes())
+        else:
+            _update("text", source.encode("utf-8"))
+    # Compiler identity is its path plus stat, the same check ccache is configured with
+    compilers = mlc_config.probe_compiler()
+    if compilers:
+        stat = compilers[0].stat()
+        _update("compiler", f"{compilers[0]}:{stat.st_size}:{stat.st_mtime_ns}".encode())
+    for option in options:
+        _update("option", option.encode("utf-8"))
+    for k, v in sorted((str(k), str(v)) for k, v in build_info().items()):
+        _update("build_info", f"{k}={v}".encode())
+    _update("platform", f"{SYSTEM}{DSO_SUFFIX}".encode())
+    return h.hexdigest()[:32]
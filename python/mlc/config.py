@@ -18,6 +18,14 @@ def libdir() -> Path:
     return LIB_PATH.parent.resolve()
 
 
+def cachedir() -> Path:
+    if path := os.environ.get("MLC_CACHE_DIR"):
+        return Path(path)
+    if path := os.environ.get("XDG_CACHE_HOME"):
+        return Path(path) / "mlc"
+    return Path.home() / ".cache" / "mlc"
+
+
 def probe_vcvarsall() -> Path:
     for path in probe_msvc():
         cur = path
@@ -80,6 +88,7 @@ def main() -> None:
     parser.add_argument("--build-info", action="store_true", help="Print build information")
     parser.add_argument("--includedir", action="store_true", help="Print the include directory")
     parser.add_argument("--libdir", action="store_true", help="Print the library directory")
+    parser.add_argument("--cachedir", action="store_true", help="Print the cache directory")
     parser.add_argument("--probe-compiler", action="store_true", help="Probe the compiler")
     parser.add_argument("--probe-msvc", action="store_true", help="Probe MSVC")
     parser.add_argument("--probe-vcvarsall", action="store_true", help="Probe vcvarsall.bat")
@@ -98,6 +107,9 @@ def main() -> None:
     if args.libdir:
         has_action = True
         print(libdir())
+    if args.cachedir:
+        has_action = True
+        print(cachedir())
     if args.probe_compiler:
         has_action = True
         print(_tuple_path_to_str(probe_compiler()))
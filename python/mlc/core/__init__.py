@@ -3,9 +3,11 @@ from .device import Device
 from .dict import Dict
 from .dtype import DataType
 from .error import Error
-from .func import Func, build_info, json_loads
+from .func import Func, build_info, json_loads, set_traceback_enabled
+from .intern_table import StructuralInternTable
 from .list import List
-from .object import Object
+from .object import Object, set_identity_cache_enabled
 from .object_path import ObjectPath
 from .opaque import Opaque
 from .tensor import Tensor
+from .typed_list import TypedList
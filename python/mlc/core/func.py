@@ -46,5 +46,10 @@ def build_info() -> dict[str, Any]:
     return _build_info()
 
 
+def set_traceback_enabled(enabled: bool) -> bool:
+    return _traceback_set_enabled(enabled)
+
+
 _json_loads = Func.get("mlc.core.JSONLoads")
 _build_info = Func.get("mlc.core.BuildInfo")
+_traceback_set_enabled = Func.get("mlc.core.TracebackSetEnabled")
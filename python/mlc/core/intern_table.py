@@ -0,0 +1,29 @@
+from __future__ import annotations
+
+from typing import Any
+
+from mlc._cython import c_class_core
+
+from .dict import Dict
+from .object import Object
+
+
+@c_class_core("mlc.core.StructuralInternTable")
+class StructuralInternTable(Object):
+    bind_free_vars: bool
+    tensor_content: bool
+
+    def __init__(self, *, bind_free_vars: bool = False, tensor_content: bool = False) -> None:
+        self._mlc_init(bind_free_vars, tensor_content)
+
+    def intern(self, node: Any) -> Any:
+        return StructuralInternTable._C(b"intern", self, node)
+
+    def lookup(self, node: Any) -> Any:
+        return StructuralInternTable._C(b"lookup", self, node)
+
+    def intern_graph(self, root: Any) -> Dict[Object, Object]:
+        return StructuralInternTable._C(b"intern_graph", self, root)
+
+    def __len__(self) -> int:
+        return StructuralInternTable._C(b"size", self)
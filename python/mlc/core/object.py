@@ -2,7 +2,10 @@ from __future__ import annotations
 
 import typing
 
-from mlc._cython import PyAny, c_class_core
+from mlc._cython import PyAny, c_class_core, identity_cache_set_enabled
+
+if typing.TYPE_CHECKING:
+    from .object_path import ObjectPath
 
 
 @c_class_core("object.Object")
@@ -13,8 +16,8 @@ class Object(PyAny):
 
         init(*args, **kwargs)
 
-    def json(self) -> str:
-        return super()._mlc_json()
+    def json(self, *, dedup_tensor_content: bool = False) -> str:
+        return super()._mlc_json(dedup_tensor_content)
 
     @staticmethod
     def from_json(json_str: str) -> Object:
@@ -26,19 +29,38 @@ class Object(PyAny):
         *,
         bind_free_vars: bool = True,
         assert_mode: bool = False,
+        tensor_content: bool = False,
     ) -> bool:
-        return PyAny._mlc_eq_s(self, other, bind_free_vars, assert_mode)  # type: ignore[attr-defined]
+        return PyAny._mlc_eq_s(self, other, bind_free_vars, assert_mode, tensor_content)  # type: ignore[attr-defined]
 
     def eq_s_fail_reason(
         self,
         other: Object,
         *,
         bind_free_vars: bool = True,
+        tensor_content: bool = False,
     ) -> tuple[bool, str]:
-        return PyAny._mlc_eq_s_fail_reason(self, other, bind_free_vars)
+        return PyAny._mlc_eq_s_fail_reason(self, other, bind_free_vars, tensor_content)
 
-    def hash_s(self) -> int:
-        return PyAny._mlc_hash_s(self)  # type: ignore[attr-defined]
+    def diff_s(
+        self,
+        other: Object,
+        *,
+        bind_free_vars: bool = True,
+        tensor_content: bool = False,
+        max_diffs: int | None = None,
+    ) -> list[tuple[ObjectPath, ObjectPath, str]]:
+        diffs = PyAny._mlc_diff_s(  # type: ignore[attr-defined]
+            self,
+            other,
+            bind_free_vars,
+            tensor_content,
+            -1 if max_diffs is None else max_diffs,
+        )
+        return [(lhs_path, rhs_path, reason) for lhs_path, rhs_path, reason in diffs]
+
+    def hash_s(self, *, tensor_content: bool = False) -> int:
+        return PyAny._mlc_hash_s(self, tensor_content)  # type: ignore[attr-defined]
 
     def eq_ptr(self, other: typing.Any) -> bool:
         return isinstance(other, Object) and self._mlc_address == other._mlc_address
@@ -49,6 +71,9 @@ class Object(PyAny):
     def __deepcopy__(self: Object, memo: dict[int, Object] | None) -> Object:
         return PyAny._mlc_copy_deep(self)
 
+    def copy_deep(self: Object, *, share_frozen: bool = False, num_threads: int = 1) -> Object:
+        return PyAny._mlc_copy_deep(self, share_frozen, num_threads)  # type: ignore[attr-defined]
+
     def __replace__(self: Object, /, **changes: typing.Any) -> Object:
         unpacked: list[typing.Any] = [self]
         for key, value in changes.items():
@@ -70,3 +95,12 @@ class Object(PyAny):
             self._mlc_swap(other)
         else:
             raise TypeError(f"Cannot different types: `{type(self)}` and `{type(other)}`")
+
+
+def set_identity_cache_enabled(enabled: bool) -> bool:
+    """Makes every conversion of an MLC object to Python return its existing wrapper, if any.
+
+    While enabled, `lst[0] is lst[0]` holds, and walking a graph does not allocate a new wrapper
+    for a node that already has one alive. Returns whether the cache was previously enabled.
+    """
+    return identity_cache_set_enabled(enabled)
@@ -18,6 +18,10 @@ class ObjectPath(Object):
     def root() -> ObjectPath:
         return ObjectPath._C(b"root")
 
+    @staticmethod
+    def interned_root() -> ObjectPath:
+        return ObjectPath._C(b"interned_root")
+
     def with_field(self, field: str) -> ObjectPath:
         return ObjectPath._C(b"with_field", self, field)
 
@@ -1,5 +1,7 @@
 from __future__ import annotations
 
+import ctypes
+from collections.abc import Callable
 from typing import TYPE_CHECKING, Any
 
 import numpy as np
@@ -16,6 +18,7 @@ from mlc._cython import (
     tensor_shape,
     tensor_strides,
     tensor_to_dlpack,
+    tensor_to_dlpack_versioned,
 )
 
 from .func import Func
@@ -63,11 +66,52 @@ class Tensor(Object):
     def base64(self) -> str:
         return TensorToBase64(self)
 
+    def to_bytes_chunked(self, chunk_size: int, write: Callable[[bytes], Any]) -> None:
+        """Pass the serialized bytes of the tensor to `write` in chunks of `chunk_size` bytes.
+
+        The chunks join into the payload that `base64` encodes, which is never built as a whole.
+        """
+        TensorToBytesChunked(
+            self,
+            chunk_size,
+            lambda data, size: write(ctypes.string_at(data, size)),
+        )
+
     @staticmethod
     def from_base64(base64: str) -> Tensor:
         return TensorFromBase64(base64)
 
-    def __dlpack__(self) -> Any:
+    @staticmethod
+    def empty(
+        shape: tuple[int, ...] | list[int],
+        dtype: str | DataType,
+        device: str | Device = "cpu",
+    ) -> Tensor:
+        return TensorEmpty(list(shape), dtype, device)
+
+    @staticmethod
+    def pool_stats() -> dict[str, int]:
+        return dict(TensorPoolStats().items())
+
+    @staticmethod
+    def pool_release() -> None:
+        TensorPoolRelease()
+
+    def __dlpack__(
+        self,
+        *,
+        stream: Any = None,
+        max_version: tuple[int, int] | None = None,
+        dl_device: tuple[int, int] | None = None,
+        copy: bool | None = None,
+    ) -> Any:
+        if copy:
+            raise BufferError("Tensor.__dlpack__ does not support `copy=True`")
+        if dl_device is not None and tuple(dl_device) != self.__dlpack_device__():
+            raise BufferError(f"Tensor.__dlpack__ cannot export to device: {dl_device}")
+        # Consumers import legacy capsules as read-only, e.g. numpy 2
+        if max_version is not None and max_version[0] >= 1:
+            return tensor_to_dlpack_versioned(self)
         return tensor_to_dlpack(self)
 
     def __dlpack_device__(self) -> tuple[int, int]:
@@ -83,4 +127,8 @@ class Tensor(Object):
 
 
 TensorToBase64 = Func.get("mlc.core.TensorToBase64")
+TensorToBytesChunked = Func.get("mlc.core.TensorToBytesChunked")
 TensorFromBase64 = Func.get("mlc.core.TensorFromBase64")
+TensorEmpty = Func.get("mlc.core.TensorEmpty")
+TensorPoolStats = Func.get("mlc.core.TensorPoolStats")
+TensorPoolRelease = Func.get("mlc.core.TensorPoolRelease")
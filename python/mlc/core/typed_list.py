@@ -0,0 +1,91 @@
+from __future__ import annotations
+
+from collections.abc import Iterable, Iterator, Sequence
+from typing import TYPE_CHECKING, Any, TypeVar, overload
+
+from mlc._cython import Ptr, c_class_core, dtype_normalize, typed_list_buffer
+
+from .list import List, ListMeta, _normalize_index
+from .object import Object
+
+if TYPE_CHECKING:
+    import numpy as np
+
+    from mlc.core import DataType
+
+T = TypeVar("T", bool, int, float)
+
+
+@c_class_core("mlc.core.TypedList")
+class TypedList(Object, Sequence[T], metaclass=ListMeta):
+    capacity: int
+    size: int
+    data: Ptr
+    dtype: DataType
+
+    def __init__(self, iterable: Iterable[T] = (), dtype: Any = "int64") -> None:
+        self._mlc_init(dtype_normalize(dtype), *iterable)
+
+    def __len__(self) -> int:
+        return self.size
+
+    @overload
+    def __getitem__(self, i: int) -> T: ...
+
+    @overload
+    def __getitem__(self, i: slice) -> Sequence[T]: ...
+
+    def __getitem__(self, i: int | slice) -> T | Sequence[T]:
+        if isinstance(i, int):
+            i = _normalize_index(i, len(self))
+            return TypedList._C(b"__iter_at__", self, i)
+        elif isinstance(i, slice):
+            start, stop, step = i.indices(len(self))
+            return TypedList([self[i] for i in range(start, stop, step)], dtype=self.dtype)
+        else:
+            raise TypeError(f"list indices must be integers or slices, not {type(i).__name__}")
+
+    def __setitem__(self, index: int, value: T) -> None:
+        length = len(self)
+        if not -length <= index < length:
+            raise IndexError(f"list assignment index out of range: {index}")
+        if index < 0:
+            index += length
+        TypedList._C(b"__setitem__", self, index, value)
+
+    def __iter__(self) -> Iterator[T]:
+        return iter(self[i] for i in range(len(self)))
+
+    def append(self, x: T) -> None:
+        return TypedList._C(b"_append", self, x)
+
+    def extend(self, iterable: Iterable[T]) -> None:
+        for x in iterable:
+            self.append(x)
+
+    def to_list(self) -> List[T]:
+        return TypedList._C(b"_to_list", self)
+
+    @staticmethod
+    def from_list(source: Iterable[T], dtype: Any = "int64") -> TypedList[T]:
+        return TypedList._C(b"_from_list", source, dtype_normalize(dtype))
+
+    def __buffer__(self, flags: int) -> memoryview:
+        return typed_list_buffer(self)
+
+    def numpy(self) -> np.ndarray:
+        import numpy as np
+
+        return np.frombuffer(typed_list_buffer(self), dtype=str(self.dtype))
+
+    def __eq__(self, other: Any) -> bool:
+        if isinstance(other, TypedList) and self._mlc_address == other._mlc_address:
+            return True
+        if not isinstance(other, (list, tuple, List, TypedList)):
+            return False
+        if len(self) != len(other):
+            return False
+        return all(a == b for a, b in zip(self, other))
+
+    def __ne__(self, other: Any) -> bool:
+        return not (self == other)
@@ -4,7 +4,9 @@ from .utils import (
     Structure,
     add_vtable_method,
     field,
+    gather_fields,
     prototype,
     replace,
+    scatter_fields,
     vtable_method,
 )
@@ -49,13 +49,7 @@ def c_class(
         # Step 3. Attach fields
         setattr(type_cls, "_mlc_type_info", type_info)
         for field in type_info.fields:
-            attach_field(
-                cls=type_cls,
-                name=field.name,
-                getter=field.getter,
-                setter=field.setter,
-                frozen=field.frozen,
-            )
+            attach_field(type_cls, field)
 
         # Step 4. Attach methods
         if init:
@@ -15,7 +15,7 @@ from mlc._cython import (
     type_add_method,
     type_create,
     type_create_instance,
-    type_field_get_accessor,
+    type_field_init_accessor,
     type_register_fields,
     type_register_structure,
 )
@@ -26,7 +26,7 @@ from .utils import (
     add_vtable_methods_for_type_cls,
     get_parent_type,
     inspect_dataclass_fields,
-    method_init,
+    method_init_compiled,
     structure_parse,
     structure_to_c,
 )
@@ -49,6 +49,7 @@ def py_class(
     *,
     init: bool = True,
     repr: bool = True,
+    frozen: bool = False,
     structure: typing.Literal["bind", "nobind", "var"] | None = None,
 ) -> Callable[[type[ClsType]], type[ClsType]]:
     if isinstance(type_key, type):
@@ -56,6 +57,7 @@ def py_class(
             type_key=None,
             init=init,
             repr=repr,
+            frozen=frozen,
             structure=structure,
         )(type_key)
     if structure not in (None, "bind", "nobind", "var"):
@@ -87,6 +89,9 @@ def py_class(
             super_type_cls,
             parent_type_info,
         )
+        if frozen:
+            for field in fields:
+                field.frozen = True
         num_bytes = _add_field_properties(fields)
         type_info.fields = tuple(fields)
         type_info.d_fields = tuple(d_fields)
@@ -107,13 +112,7 @@ def py_class(
         type_info.type_cls = type_cls
         setattr(type_cls, "_mlc_type_info", type_info)
         for field in fields:
-            attach_field(
-                type_cls,
-                name=field.name,
-                getter=field.getter,
-                setter=field.setter,
-                frozen=field.frozen,
-            )
+            attach_field(type_cls, field)
 
         # Step 4. Register the structure of the class
         struct: Structure
@@ -146,7 +145,7 @@ def py_class(
         # Step 6. Attach methods
         fn: Callable[..., typing.Any]
         if init:
-            fn = method_init(super_type_cls, d_fields)
+            fn = method_init_compiled(super_type_cls, d_fields, fields)
             attach_method(super_type_cls, type_cls, "__init__", fn, check_exists=True)
         if repr:
             fn = _method_repr(type_key, fields)
@@ -171,7 +170,7 @@ def _add_field_properties(type_fields: list[TypeField]) -> int:
 
     for field in type_fields:
         field.offset = getattr(CType, field.name).offset
-        field.getter, field.setter = type_field_get_accessor(field)
+        type_field_init_accessor(field)
     return ctypes.sizeof(CType)
 
 
@@ -6,16 +6,20 @@ import functools
 import inspect
 import re
 import typing
-from collections.abc import Callable
+from collections.abc import Callable, Iterable
 from io import StringIO
 from typing import Any, Literal, TypeVar, get_type_hints
 
 from mlc._cython import (
     MISSING,
     Field,
+    FieldAccessor,
     TypeField,
     TypeInfo,
     TypeMethod,
+    fields_gather,
+    fields_scatter,
+    make_py_class_init,
     type_add_method,
     type_index2type_methods,
     type_table,
@@ -30,10 +34,10 @@ class DefaultFactory(typing.NamedTuple):
     fn: Callable[[], typing.Any]
 
 
-def method_init(
+def _init_signature(
     type_cls: type,
     fields: list[Field],
-) -> Callable[..., None]:
+) -> tuple[inspect.Signature, list[int], dict[str, typing.Any], str]:
     annotations: dict[str, typing.Any] = {"return": None}
     params_without_defaults: list[inspect.Parameter] = []
     params_with_defaults: list[inspect.Parameter] = []
@@ -74,6 +78,14 @@ def method_init(
         + ", ".join(p.name for p in sig.parameters.values())
         + ")"
     )
+    return sig, ordering, annotations, signature_str
+
+
+def method_init(
+    type_cls: type,
+    fields: list[Field],
+) -> Callable[..., None]:
+    sig, ordering, annotations, signature_str = _init_signature(type_cls, fields)
 
     def bind_args(*args: typing.Any, **kwargs: typing.Any) -> inspect.BoundArguments:
         bound = sig.bind(*args, **kwargs)
@@ -103,6 +115,31 @@ def method_init(
     return method
 
 
+def method_init_compiled(
+    type_cls: type,
+    fields: list[Field],
+    type_fields: list[TypeField],
+) -> Callable[..., None]:
+    """Same as `method_init`, but binds arguments in Cython and sets `type_fields` directly.
+
+    Only applies to `py_class`, whose fields are all set through their accessors.
+    """
+    sig, ordering, annotations, signature_str = _init_signature(type_cls, fields)
+    method = make_py_class_init(
+        signature_str,
+        tuple(sig.parameters),
+        tuple(
+            None if p.default is inspect.Parameter.empty else p.default.fn
+            for p in sig.parameters.values()
+        ),
+        tuple(ordering),
+        type_fields,
+    )
+    method.__signature__ = sig
+    method.__annotations__ = annotations
+    return method
+
+
 def field(
     *,
     default: Any = MISSING,
@@ -170,7 +207,7 @@ def inspect_dataclass_fields(  # noqa: PLR0912
         if lhs.startswith("_"):
             continue
         rhs = getattr(type_cls, lhs, MISSING)
-        if isinstance(rhs, property):
+        if isinstance(rhs, FieldAccessor):
             for parent_d_field in parent_type_info.d_fields:
                 if parent_d_field.name == lhs:
                     rhs = parent_d_field
@@ -454,3 +491,21 @@ def prototype(
 
 def replace(obj: Any, /, **changes: Any) -> Any:
     return obj.__replace__(**changes)
+
+
+def gather_fields(objs: Iterable[Any], name: str, *, as_buffer: bool = False) -> list | memoryview:
+    """Reads field `name` of every object in `objs`.
+
+    The field is looked up once per type rather than once per object. With `as_buffer=True`, a
+    bool, int or float field is copied into a typed memoryview, e.g. for `numpy.asarray`, without
+    creating a Python object per element.
+    """
+    return fields_gather(objs, name, as_buffer)
+
+
+def scatter_fields(objs: Iterable[Any], name: str, values: Iterable[Any]) -> None:
+    """Writes `values[i]` to field `name` of the i-th object in `objs`, the inverse of `gather_fields`.
+
+    `values` may also be a 1-dimensional buffer such as the one `gather_fields` returns.
+    """
+    fields_scatter(objs, name, values)
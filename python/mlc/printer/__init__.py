@@ -12,4 +12,6 @@ from .ir_printer import (
     Str,
     print_python,
     to_python,
+    to_python_module,
+    to_python_stream,
 )
@@ -7,7 +7,7 @@ if typing.TYPE_CHECKING:
     import pygments  # type: ignore[import-untyped]
 
 
-def cprint(printable: str, style: str | None = None) -> None:
+def cprint(printable: str, style: str | None = None, file: typing.TextIO | None = None) -> None:
     """Print Python code with Pygments highlight.
 
     Parameters
@@ -16,6 +16,10 @@ def cprint(printable: str, style: str | None = None) -> None:
 
         Pygmentize printing style, auto-detected if None.
 
+    file : TextIO, optional
+
+        Stream to print to, `sys.stdout` if None. Output to a stream is never displayed as HTML.
+
     Notes
     -----
 
@@ -27,12 +31,13 @@ def cprint(printable: str, style: str | None = None) -> None:
     installing the Pygment library. Other Pygment styles can be found in
     https://pygments.org/styles/
     """
-    is_in_notebook = "ipykernel" in sys.modules  # in notebook env (support html display).
+    # in notebook env (support html display).
+    is_in_notebook = file is None and "ipykernel" in sys.modules
 
     pygment_style = _get_pygments_style(style, is_in_notebook)
 
     if pygment_style is None:
-        print(printable)
+        print(printable, file=file)
         return
 
     # pylint: disable=import-outside-toplevel
@@ -51,7 +56,10 @@ def cprint(printable: str, style: str | None = None) -> None:
         html = highlight(printable, Python3Lexer(), formatter)
         display.display(display.HTML(html))
     else:
-        print(highlight(printable, Python3Lexer(), Terminal256Formatter(style=pygment_style)))
+        print(
+            highlight(printable, Python3Lexer(), Terminal256Formatter(style=pygment_style)),
+            file=file,
+        )
 
 
 def _get_pygments_style(
@@ -1,6 +1,6 @@
 import contextlib
-from collections.abc import Generator
-from typing import Any, Optional, TypeVar, Union
+from collections.abc import Callable, Generator, Sequence
+from typing import Any, Optional, TextIO, TypeVar, Union
 
 import mlc.dataclasses as mlcd
 from mlc.core import Func, Object, ObjectPath
@@ -115,6 +115,8 @@ class IRPrinter(Object):
 
 
 _C_ToPython = Func.get("mlc.printer.ToPython")
+_C_ToPythonStream = Func.get("mlc.printer.ToPythonStream")
+_C_ToPythonModule = Func.get("mlc.printer.ToPythonModule")
 
 
 def to_python(obj: Any, cfg: Optional[PrinterConfig] = None) -> str:
@@ -123,9 +125,37 @@ def to_python(obj: Any, cfg: Optional[PrinterConfig] = None) -> str:
     return _C_ToPython(obj, cfg)
 
 
+def to_python_stream(
+    obj: Any, write: Callable[[str], Any], cfg: Optional[PrinterConfig] = None
+) -> None:
+    """Same as `to_python`, but hands the text to `write` piece by piece instead of building it as a whole."""
+    if cfg is None:
+        cfg = PrinterConfig()
+    _C_ToPythonStream(obj, cfg, write)
+
+
+def to_python_module(
+    items: Sequence[Any],
+    cfg: Optional[PrinterConfig] = None,
+    num_threads: int = 0,
+) -> str:
+    """Print independent top-level items, e.g. functions, as one module.
+
+    Each item is printed with its own `IRPrinter` on one of `num_threads` threads (0 for all
+    hardware threads). The output doesn't depend on `num_threads`.
+    """
+    if cfg is None:
+        cfg = PrinterConfig()
+    return _C_ToPythonModule(list(items), cfg, num_threads)
+
+
 def print_python(
     obj: Any,
     cfg: Optional[PrinterConfig] = None,
     style: Optional[str] = None,
+    file: Optional[TextIO] = None,
 ) -> None:
-    cprint(to_python(obj, cfg=cfg), style=style)
+    if file is not None and style is None:
+        to_python_stream(obj, file.write, cfg=cfg)
+        return
+    cprint(to_python(obj, cfg=cfg), style=style, file=file)
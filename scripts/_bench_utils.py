@@ -0,0 +1,15 @@
+"""Timing helper shared by the `bench_*.py` scripts."""
+
+import time
+from collections.abc import Callable
+
+
+def best_of(fn: Callable[[], object], repeat: int) -> float:
+    """Calls `fn` once to warm up, then `repeat` more times, and returns the fastest call in seconds."""
+    fn()
+    best = float("inf")
+    for _ in range(repeat):
+        start = time.perf_counter()
+        fn()
+        best = min(best, time.perf_counter() - start)
+    return best
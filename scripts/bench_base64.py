@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+"""Measures the throughput of the tensor base64 codec, in GB/s of raw tensor payload.
+
+Two directions are timed on a random `uint8` tensor:
+- `enc`: `mlc.Tensor.base64`;
+- `dec`: `mlc.Tensor.from_base64`.
+"""
+
+import argparse
+from collections.abc import Callable
+
+import mlc
+import numpy as np
+
+from _bench_utils import best_of
+
+
+def bench(name: str, fn: Callable[[], object], num_bytes: int, repeat: int) -> None:
+    best = best_of(fn, repeat)
+    print(f"{name:>3}: {num_bytes} bytes, best of {repeat}: {best * 1e3:.2f} ms, {num_bytes / best / 1e9:.2f} GB/s")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--size-mb", type=int, default=64)
+    parser.add_argument("--repeat", type=int, default=5)
+    args = parser.parse_args()
+
+    num_bytes = args.size_mb << 20
+    tensor = mlc.Tensor(np.random.default_rng(0).integers(0, 256, size=num_bytes, dtype=np.uint8))
+    encoded = tensor.base64()
+    bench("enc", tensor.base64, num_bytes, args.repeat)
+    bench("dec", lambda: mlc.Tensor.from_base64(encoded), num_bytes, args.repeat)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""Measures the throughput of field access, in million operations per second, on testing classes.
+
+Each field kind below is read (`get`) and written (`set`) in a tight loop on both
+`mlc.testing.c_class` and `mlc.testing.py_class` objects, and then read and written across many
+objects, one attribute access at a time versus `gather_fields` and `scatter_fields`.
+"""
+
+import argparse
+from collections.abc import Callable
+from typing import Any
+
+import mlc
+from mlc.testing.dataclasses import CClassForTest, PyClassForTest
+
+FIELDS: dict[str, Any] = {
+    "bool_": True,
+    "i64": 64,
+    "f64": 2.5,
+    "dtype": "float32",
+    "any": "hello",
+    "str_": "world",
+    "list_any": mlc.List([1, 2]),
+    "opt_i64": 7,
+    "opt_str": "opt",
+}
+
+from _bench_utils import best_of
+
+
+def make_kwargs() -> dict[str, Any]:
+    return {
+        "bool_": False,
+        "i8": 8,
+        "i16": 16,
+        "i32": 32,
+        "i64": 64,
+        "f32": 1.5,
+        "f64": 2.5,
+        "raw_ptr": mlc.Ptr(0),
+        "dtype": "float32",
+        "device": "cpu",
+        "any": None,
+        "func": lambda x: x,
+        "ulist": [],
+        "udict": {},
+        "str_": "",
+        "str_readonly": "",
+        "list_any": [],
+        "list_list_int": [],
+        "dict_any_any": {},
+        "dict_str_any": {},
+        "dict_any_str": {},
+        "dict_str_list_int": {},
+        "opt_bool": None,
+        "opt_i64": None,
+        "opt_f64": None,
+        "opt_raw_ptr": None,
+        "opt_dtype": None,
+        "opt_device": None,
+        "opt_func": None,
+        "opt_ulist": None,
+        "opt_udict": None,
+        "opt_str": None,
+        "opt_list_any": None,
+        "opt_list_list_int": None,
+        "opt_dict_any_any": None,
+        "opt_dict_str_any": None,
+        "opt_dict_any_str": None,
+        "opt_dict_str_list_int": None,
+    }
+
+
+def bench(name: str, fn: Callable[[int], None], number: int, repeat: int) -> None:
+    fn(number // 10)  # warm up
+    best = best_of(lambda: fn(number), repeat)
+    print(f"{name:>24}: best of {repeat}: {number / best / 1e6:.2f} Mops/s")
+
+
+def make_get(obj: Any, field: str) -> Callable[[int], None]:
+    def fn(number: int) -> None:
+        for _ in range(number):
+            getattr(obj, field)
+
+    return fn
+
+
+def make_set(obj: Any, field: str, value: Any) -> Callable[[int], None]:
+    def fn(number: int) -> None:
+        for _ in range(number):
+            setattr(obj, field, value)
+
+    return fn
+
+
+def bench_batch(objs: list[Any], field: str, number: int, repeat: int) -> None:
+    values = [getattr(obj, field) for obj in objs]
+    batches = {
+        "getattr": lambda: [getattr(obj, field) for obj in objs],
+        "gather_fields": lambda: mlc.dataclasses.gather_fields(objs, field),
+        "gather_fields(buffer)": lambda: mlc.dataclasses.gather_fields(objs, field, as_buffer=True),
+        "setattr": lambda: [setattr(obj, field, v) for obj, v in zip(objs, values)],
+        "scatter_fields": lambda: mlc.dataclasses.scatter_fields(objs, field, values),
+    }
+    if not isinstance(values[0], (bool, int, float)):
+        del batches["gather_fields(buffer)"]
+    for name, batch in batches.items():
+
+        def fn(number: int, batch: Callable[[], Any] = batch) -> None:
+            for _ in range(max(1, number // len(objs))):
+                batch()
+
+        bench(f"{field} {name}", fn, number, repeat)
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--number", type=int, default=200_000)
+    parser.add_argument("--repeat", type=int, default=5)
+    parser.add_argument("--num-objs", type=int, default=10_000)
+    args = parser.parse_args()
+
+    for cls in (CClassForTest, PyClassForTest):
+        obj = cls(**make_kwargs())
+        for field, value in FIELDS.items():
+            prefix = f"{cls.__name__.removesuffix('ForTest')}.{field}"
+            bench(f"{prefix} get", make_get(obj, field), args.number, args.repeat)
+            bench(f"{prefix} set", make_set(obj, field, value), args.number, args.repeat)
+
+    for cls in (CClassForTest, PyClassForTest):
+        print(f"{args.num_objs} {cls.__name__.removesuffix('ForTest')} objects:")
+        objs = [cls(**make_kwargs()) for _ in range(args.num_objs)]
+        for field in ("i64", "f64", "str_"):
+            bench_batch(objs, field, args.number, args.repeat)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,37 @@
+#!/usr/bin/env python3
+"""Measures `StructuralInternTable.intern_graph` on chains of nested lists, in thousand nodes per second.
+
+Each case interns a chain into a table that already holds a structurally equal copy, so every node
+is compared against a candidate. The rate should stay flat as the chain grows.
+"""
+
+import argparse
+
+import mlc
+
+from _bench_utils import best_of
+
+
+def chain(n: int) -> mlc.List:
+    x = mlc.List([0])
+    for i in range(n):
+        x = mlc.List([x, i])
+    return x
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--sizes", type=int, nargs="+", default=[1000, 2000, 4000, 8000, 16000])
+    parser.add_argument("--repeat", type=int, default=5)
+    args = parser.parse_args()
+
+    for n in args.sizes:
+        table = mlc.StructuralInternTable()
+        table.intern_graph(chain(n))
+        roots = iter([chain(n) for _ in range(args.repeat + 1)])
+        best = best_of(lambda: table.intern_graph(next(roots)), args.repeat)
+        print(f"{n:>8} nodes: best of {args.repeat}: {(n + 1) / best / 1e3:.1f} Knode/s")
+
+
+if __name__ == "__main__":
+    main()
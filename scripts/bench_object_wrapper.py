@@ -0,0 +1,57 @@
+#!/usr/bin/env python3
+"""Measures how fast MLC objects are converted to Python wrappers, in million objects per second.
+
+Each case reads the object-typed field `child` of many `Holder`s via `gather_fields`, with the
+identity cache from `mlc.set_identity_cache_enabled` disabled and enabled. The original wrappers of
+the children are kept alive, so with the cache enabled, every conversion returns one of them.
+"""
+
+import argparse
+from collections.abc import Callable
+
+import mlc
+import mlc.dataclasses as mlcd
+
+from _bench_utils import best_of
+
+
+@mlcd.py_class("mlc.bench.Node")
+class Node(mlcd.PyClass):
+    value: int
+
+
+@mlcd.py_class("mlc.bench.Holder")
+class Holder(mlcd.PyClass):
+    child: mlc.Object
+
+
+def bench(name: str, fn: Callable[[], None], number: int, repeat: int) -> None:
+    best = best_of(fn, repeat)
+    print(f"{name:>32}: best of {repeat}: {number / best / 1e6:.2f} Mobj/s")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--number", type=int, default=100_000)
+    parser.add_argument("--repeat", type=int, default=5)
+    args = parser.parse_args()
+
+    cases = {
+        "c_class child": [mlc.List([i]) for i in range(args.number)],
+        "py_class child": [Node(i) for i in range(args.number)],
+    }
+    for name, children in cases.items():
+        holders = [Holder(child) for child in children]
+
+        def fn(holders: list[Holder] = holders) -> None:
+            mlcd.gather_fields(holders, "child")
+
+        bench(f"{name} cache=False", fn, args.number, args.repeat)
+        mlc.set_identity_cache_enabled(True)
+        mlc.List(children)  # registers the wrappers in `children` in the cache
+        bench(f"{name} cache=True", fn, args.number, args.repeat)
+        mlc.set_identity_cache_enabled(False)
+
+
+if __name__ == "__main__":
+    main()
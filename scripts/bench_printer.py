@@ -0,0 +1,69 @@
+#!/usr/bin/env python3
+"""Measures the throughput of the IR printer, in printed nodes per second, on a synthetic AST.
+
+Two workloads are timed:
+- `doc`: formats a prebuilt `mlc.printer.ast` tree, which only exercises `DocPrinter`;
+- `ir`: prints a `toy_ir.Func` end to end via `mlc.printer.ToPython`.
+"""
+
+import argparse
+from collections.abc import Callable
+
+import mlc.printer as mlcp
+import mlc.printer.ast as mlt
+from mlc.testing.toy_ir import Add, Assign, Func, Var
+
+from _bench_utils import best_of
+
+
+def build_doc(num_stmts: int) -> tuple[mlt.Node, int]:
+    body: list[mlt.Stmt] = []
+    num_nodes = 0
+    for i in range(num_stmts):
+        # v_i = a + b * f(a[i], b.c)
+        rhs = mlt.Id("a") + mlt.Id("b") * mlt.Id("f").call(
+            mlt.Id("a")[mlcp.Int(i)],
+            mlt.Id("b").attr("c"),
+        )
+        body.append(mlt.Assign(lhs=mlt.Id(f"v{i}"), rhs=rhs))
+        num_nodes += 13
+    func = mlt.Function(
+        name=mlt.Id("main"),
+        args=[mlt.Assign(lhs=mlt.Id("a")), mlt.Assign(lhs=mlt.Id("b"))],
+        decorators=[],
+        return_type=None,
+        body=body,
+    )
+    return func, num_nodes + 6
+
+
+def build_ir(num_stmts: int) -> tuple[Func, int]:
+    a, b = Var(name="a"), Var(name="b")
+    stmts = []
+    prev = a
+    for i in range(num_stmts):
+        v = Var(name=f"v{i}")
+        stmts.append(Assign(lhs=v, rhs=Add(prev, b)))
+        prev = v
+    return Func(name="main", args=[a, b], stmts=stmts, ret=prev), 5 * num_stmts + 4
+
+
+def bench(name: str, fn: Callable[[], str], num_nodes: int, repeat: int) -> None:
+    best = best_of(fn, repeat)
+    print(f"{name:>4}: {num_nodes} nodes, best of {repeat}: {best * 1e3:.2f} ms, {num_nodes / best:,.0f} nodes/sec")
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--num-stmts", type=int, default=20000)
+    parser.add_argument("--repeat", type=int, default=5)
+    args = parser.parse_args()
+
+    doc, num_doc_nodes = build_doc(args.num_stmts)
+    bench("doc", doc.to_python, num_doc_nodes, args.repeat)
+    func, num_ir_nodes = build_ir(args.num_stmts)
+    bench("ir", lambda: mlcp.to_python(func), num_ir_nodes, args.repeat)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Measures `py_class` construction, in thousand objects per second.
+
+Each case builds an object through `mlc.dataclasses.utils.method_init`, which binds arguments with
+`inspect.Signature`, and through the compiled `__init__` that `py_class` attaches.
+"""
+
+import argparse
+from collections.abc import Callable
+from typing import Any, Optional
+
+import mlc
+import mlc.dataclasses as mlcd
+from mlc.dataclasses.utils import method_init
+
+from _bench_utils import best_of
+
+
+@mlcd.py_class("mlc.bench.Var")
+class Var(mlcd.PyClass):
+    name: str
+    dtype: mlc.DataType = mlcd.field(default_factory=lambda: mlc.DataType("int32"))
+
+
+@mlcd.py_class("mlc.bench.Add")
+class Add(mlcd.PyClass):
+    a: Any
+    b: Any
+    span: Optional[int] = None
+
+
+CASES: dict[str, tuple[type, tuple[Any, ...], dict[str, Any]]] = {
+    "Var(name)": (Var, ("x",), {}),
+    "Var(name, dtype)": (Var, ("x",), {"dtype": mlc.DataType("float32")}),
+    "Add(a, b)": (Add, (1, 2), {}),
+    "Add(a=, b=, span=)": (Add, (), {"a": 1, "b": 2, "span": 3}),
+}
+
+
+def bench(name: str, fn: Callable[[int], None], number: int, repeat: int) -> None:
+    fn(number // 10)  # warm up
+    best = best_of(lambda: fn(number), repeat)
+    print(f"{name:>32}: best of {repeat}: {number / best / 1e3:.1f} Kobj/s")
+
+
+def make_fn(
+    cls: type,
+    init: Callable[..., None],
+    args: tuple[Any, ...],
+    kwargs: dict[str, Any],
+) -> Callable[[int], None]:
+    def fn(number: int) -> None:
+        for _ in range(number):
+            init(cls.__new__(cls), *args, **kwargs)
+
+    return fn
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser(description=__doc__)
+    parser.add_argument("--number", type=int, default=100_000)
+    parser.add_argument("--repeat", type=int, default=5)
+    args = parser.parse_args()
+
+    for name, (cls, cls_args, cls_kwargs) in CASES.items():
+        inspect_init = method_init(cls, list(cls._mlc_type_info.d_fields))
+        compiled_init = cls.__init__
+        bench(
+            f"{name} inspect",
+            make_fn(cls, inspect_init, cls_args, cls_kwargs),
+            args.number,
+            args.repeat,
+        )
+        bench(
+            f"{name} compiled",
+            make_fn(cls, compiled_init, cls_args, cls_kwargs),
+            args.number,
+            args.repeat,
+        )
+
+
+if __name__ == "__main__":
+    main()
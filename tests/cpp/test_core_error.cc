@@ -0,0 +1,97 @@
+#include "./common.h"
+#include <gtest/gtest.h>
+#include <mlc/core/all.h>
+#include <string>
+#include <vector>
+
+namespace {
+using namespace mlc;
+
+int32_t ForeignSafeCall(const void *self, int32_t num_args, const MLCAny *args, MLCAny *ret) {
+  return FuncObj::SafeCallImpl(static_cast<const FuncObj *>(self), num_args, static_cast<const AnyView *>(args),
+                               static_cast<Any *>(ret));
+}
+
+// Makes calls to `func` go through `safe_call` and error propagation, as if it were defined in another library
+Func AsForeign(Func func) {
+  func->safe_call = reinterpret_cast<MLCFuncSafeCallType>(ForeignSafeCall);
+  return func;
+}
+
+std::vector<std::string> GetInfo(const ErrorObj *err) {
+  std::vector<const char *> info;
+  err->GetInfo(&info);
+  return std::vector<std::string>(info.begin(), info.end());
+}
+
+struct TracebackDisabled {
+  TracebackDisabled() : prev(::MLCTracebackSetEnabled(0)) {}
+  ~TracebackDisabled() { ::MLCTracebackSetEnabled(prev); }
+  int32_t prev;
+};
+
+TEST(Error, PropagateInPlace) {
+  TracebackDisabled guard;
+  constexpr int kDepth = 20;
+  std::vector<Func> funcs{AsForeign(Func([]() { MLC_THROW(ValueError) << "Innermost"; }))};
+  for (int i = 1; i < kDepth; ++i) {
+    funcs.push_back(AsForeign(Func([inner = funcs.back()]() { inner(); })));
+  }
+  try {
+    funcs.back()();
+    FAIL() << "No exception thrown";
+  } catch (Exception &e) {
+    EXPECT_STREQ(e.what(), "Innermost");
+    EXPECT_FALSE(e.Obj()->inner.defined());
+    std::vector<std::string> info = GetInfo(e.Obj());
+    // The message, the throw site, and one call site per boundary crossed
+    ASSERT_EQ(info.size(), 1 + 3 * (1 + kDepth));
+    EXPECT_EQ(info[0], "Innermost");
+    EXPECT_EQ(info[1], __FILE__);
+    for (size_t i = 4; i < info.size(); i += 3) {
+      EXPECT_NE(info[i].find("func.h"), std::string::npos);
+      EXPECT_NE(info[i + 2].find("FuncCallCheckError"), std::string::npos);
+    }
+  }
+}
+
+TEST(Error, PropagateShared) {
+  TracebackDisabled guard;
+  Ref<ErrorObj> shared;
+  try {
+    MLC_THROW(TypeError) << "Shared";
+  } catch (Exception &e) {
+    shared = Ref<ErrorObj>(const_cast<ErrorObj *>(e.Obj()));
+  }
+  std::vector<std::string> before = GetInfo(shared.get());
+  Func func = AsForeign(Func([shared]() { throw Exception(shared); }));
+  try {
+    func();
+    FAIL() << "No exception thrown";
+  } catch (Exception &e) {
+    EXPECT_STREQ(e.what(), "Shared");
+    EXPECT_STREQ(e.Obj()->kind(), "TypeError");
+    EXPECT_EQ(e.Obj()->inner.get(), shared.get());
+    std::vector<std::string> after = GetInfo(e.Obj());
+    EXPECT_EQ(after.size(), before.size() + 3);
+    EXPECT_EQ(std::vector<std::string>(after.begin(), after.begin() + before.size()), before);
+  }
+  EXPECT_EQ(GetInfo(shared.get()), before);
+}
+
+TEST(Error, TracebackSwitch) {
+  int32_t prev = ::MLCTracebackSetEnabled(0);
+  EXPECT_EQ(::MLCTracebackGetEnabled(), 0);
+  try {
+    MLC_THROW(ValueError) << "Message";
+  } catch (Exception &e) {
+    std::vector<std::string> info = GetInfo(e.Obj());
+    ASSERT_EQ(info.size(), 4);
+    EXPECT_EQ(info[1], __FILE__);
+    EXPECT_EQ(info[2], std::to_string(__LINE__ - 5));
+    EXPECT_NE(info[3].find("TracebackSwitch"), std::string::npos);
+  }
+  EXPECT_EQ(::MLCTracebackSetEnabled(prev), 0);
+}
+
+} // namespace
@@ -284,4 +284,18 @@ TEST(ListAnyTest, ComplexOperations) {
   EXPECT_DOUBLE_EQ(sum, 40);
 }
 
+TEST(TypedListTest, ReserveTooLarge) {
+  TypedList list(::mlc::base::DType::Int(64));
+  list->Append(1);
+  try {
+    list->Reserve(int64_t{1} << 60);
+    FAIL() << "No exception thrown";
+  } catch (Exception &e) {
+    EXPECT_STREQ(e.what(), "TypedList capacity is too large: 1152921504606846976");
+  }
+  EXPECT_THROW(list->Reserve(int64_t{1} << 58), std::bad_alloc);
+  EXPECT_EQ(list->size, 1);
+  EXPECT_EQ(list->At(0).operator int64_t(), 1);
+}
+
 } // namespace
@@ -0,0 +1,94 @@
+#include "./common.h"
+#include <gtest/gtest.h>
+#include <mlc/core/all.h>
+#include <thread>
+#include <vector>
+
+namespace {
+using namespace mlc;
+using mlc::core::ObjectPath;
+using mlc::core::ObjectPathObj;
+
+TEST(ObjectPath, RootNotInterned) {
+  ObjectPath a = ObjectPath::Root();
+  EXPECT_FALSE(a->interned);
+  EXPECT_FALSE(a->WithField("a")->interned);
+  EXPECT_NE(a.get(), ObjectPath::Root().get());
+  EXPECT_TRUE(a->WithField("a")->Equal(ObjectPath::InternedRoot()->WithField("a").get()));
+}
+
+TEST(ObjectPath, InternedRoot) {
+  ObjectPath a = ObjectPath::InternedRoot();
+  ObjectPath b = ObjectPath::InternedRoot();
+  EXPECT_EQ(a.get(), b.get());
+  EXPECT_TRUE(a->interned);
+  EXPECT_EQ(a->length, 1);
+}
+
+TEST(ObjectPath, InternedSegments) {
+  ObjectPath root = ObjectPath::InternedRoot();
+  ObjectPath a = root->WithField("a")->WithListIndex(1)->WithDictKey(Any(2.5));
+  ObjectPath b = root->WithField("a")->WithListIndex(1)->WithDictKey(Any(2.5));
+  EXPECT_EQ(a.get(), b.get());
+  EXPECT_EQ(a->length, 4);
+  EXPECT_NE(a.get(), root->WithField("a")->WithListIndex(2)->WithDictKey(Any(2.5)).get());
+  EXPECT_NE(a.get(), root->WithField("b")->WithListIndex(1)->WithDictKey(Any(2.5)).get());
+  EXPECT_TRUE(root->WithField("a")->IsPrefixOf(a.get()));
+  EXPECT_FALSE(root->WithField("b")->IsPrefixOf(a.get()));
+}
+
+TEST(ObjectPath, ReleaseAndRecreate) {
+  {
+    ObjectPath a = ObjectPath::InternedRoot()->WithField("released");
+    EXPECT_EQ(a.get(), ObjectPath::InternedRoot()->WithField("released").get());
+  }
+  ObjectPath b = ObjectPath::InternedRoot()->WithField("released");
+  EXPECT_TRUE(b->interned);
+  EXPECT_EQ(b->key.operator Str(), "released");
+}
+
+TEST(ObjectPath, ReleaseAfterMutation) {
+  {
+    ObjectPath a = ObjectPath::InternedRoot()->WithField("mutated");
+    a->key = Any("renamed");
+  }
+  ObjectPath b = ObjectPath::InternedRoot()->WithField("mutated");
+  EXPECT_EQ(b->key.operator Str(), "mutated");
+}
+
+TEST(ObjectPath, EqualToNonInterned) {
+  ObjectPath root = ObjectPath::InternedRoot();
+  ObjectPath a = root->WithField("a")->WithListIndex(0);
+  ObjectPath b(1, Any(int64_t(0)), ObjectPath(0, Any("a"), root.get()).get());
+  EXPECT_FALSE(b->interned);
+  EXPECT_TRUE(a->Equal(b.get()));
+  EXPECT_TRUE(b->Equal(a.get()));
+  EXPECT_TRUE(b->IsPrefixOf(a.get()));
+  EXPECT_FALSE(b->WithListIndex(0)->interned);
+}
+
+TEST(ObjectPath, ConcurrentIntern) {
+  constexpr int kNumThreads = 4;
+  std::vector<std::vector<ObjectPath>> paths(kNumThreads);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < kNumThreads; ++t) {
+    threads.emplace_back([&paths, t]() {
+      for (int i = 0; i < 1000; ++i) {
+        ObjectPath p = ObjectPath::InternedRoot()->WithField("f")->WithListIndex(i % 10);
+        if (i % 3 == 0) {
+          paths[t].push_back(p);
+        }
+      }
+    });
+  }
+  for (std::thread &thread : threads) {
+    thread.join();
+  }
+  for (int t = 1; t < kNumThreads; ++t) {
+    for (size_t i = 0; i < paths[t].size(); ++i) {
+      EXPECT_EQ(paths[0][i].get(), paths[t][i].get());
+    }
+  }
+}
+
+} // namespace
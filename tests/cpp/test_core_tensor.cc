@@ -0,0 +1,300 @@
+#include "./common.h"
+#include <cmath>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <mlc/core/all.h>
+#include <numeric>
+#include <string>
+#include <vector>
+
+namespace {
+using namespace mlc;
+
+Tensor MakeTensor(void *data, DLDataType dtype, std::vector<int64_t> shape, std::vector<int64_t> strides,
+                  DLDevice device = {kDLCPU, 0}) {
+  struct Context {
+    std::vector<int64_t> shape;
+    std::vector<int64_t> strides;
+  };
+  Context *ctx = new Context{std::move(shape), std::move(strides)};
+  DLManagedTensor *tensor = new DLManagedTensor{};
+  tensor->dl_tensor.data = data;
+  tensor->dl_tensor.device = device;
+  tensor->dl_tensor.ndim = static_cast<int32_t>(ctx->shape.size());
+  tensor->dl_tensor.dtype = dtype;
+  tensor->dl_tensor.shape = ctx->shape.data();
+  tensor->dl_tensor.strides = ctx->strides.empty() ? nullptr : ctx->strides.data();
+  tensor->manager_ctx = ctx;
+  tensor->deleter = +[](DLManagedTensor *self) {
+    delete static_cast<Context *>(self->manager_ctx);
+    delete self;
+  };
+  return Tensor(tensor);
+}
+
+std::string ToBytes(const Tensor &tensor) {
+  Str bytes = tensor->ToBytes();
+  return std::string(bytes->data(), bytes->size());
+}
+
+std::string ToBytesChunked(const Tensor &tensor, int64_t chunk_size, std::vector<int64_t> *chunk_sizes) {
+  static FuncObj *func = Lib::FuncGetGlobal("mlc.core.TensorToBytesChunked");
+  std::string ret;
+  (*func)(tensor, chunk_size, Func([&](void *data, int64_t size) {
+            ret.append(static_cast<const char *>(data), size);
+            chunk_sizes->push_back(size);
+          }));
+  return ret;
+}
+
+// A stand-in device whose memory is host memory, but only readable through the copy hook
+DLDevice TestDevice(int64_t *num_copies) {
+  static int64_t *counter = nullptr;
+  counter = num_copies;
+  Lib::DeviceTypeRegister("mlc_test_device");
+  Lib::FuncSetGlobal("mlc.core.DeviceCopyToHost.mlc_test_device",
+                     Func([](void *dst, void *src, int64_t num_bytes, DLDevice) {
+                       std::memcpy(dst, src, num_bytes);
+                       ++*counter;
+                     }).get(),
+                     /*allow_override=*/true);
+  return DLDevice{static_cast<DLDeviceType>(Lib::DeviceTypeFromStr("mlc_test_device")), 0};
+}
+
+TEST(Tensor, ToBytesStrided) {
+  std::vector<int32_t> data(5 * 7);
+  std::iota(data.begin(), data.end(), 0);
+  // Transpose of a 5x7 matrix
+  Tensor transposed = MakeTensor(data.data(), {kDLInt, 32, 1}, {7, 5}, {1, 7});
+  std::vector<int32_t> expected;
+  for (int i = 0; i < 7; ++i) {
+    for (int j = 0; j < 5; ++j) {
+      expected.push_back(data[j * 7 + i]);
+    }
+  }
+  Tensor contiguous = MakeTensor(expected.data(), {kDLInt, 32, 1}, {7, 5}, {});
+  EXPECT_EQ(ToBytes(transposed), ToBytes(contiguous));
+  Tensor loaded = Tensor::FromBytes(transposed->ToBytes());
+  EXPECT_EQ(loaded.strides(), nullptr);
+  EXPECT_EQ(std::memcmp(loaded.data(), expected.data(), expected.size() * sizeof(int32_t)), 0);
+}
+
+TEST(Tensor, ToBytesPermuted) {
+  // A [3, 40, 50] tensor viewed as [50, 3, 40] and [40, 50, 3], with elements of 1, 2, 8 and 3 bytes
+  for (DLDataType dtype : {DLDataType{kDLUInt, 8, 1}, DLDataType{kDLFloat, 16, 1}, DLDataType{kDLInt, 64, 1},
+                           DLDataType{kDLUInt, 8, 3}}) {
+    int64_t elem_size = ::mlc::base::DType::Size(dtype);
+    std::vector<uint8_t> data(3 * 40 * 50 * elem_size);
+    for (size_t i = 0; i < data.size(); ++i) {
+      data[i] = static_cast<uint8_t>(i * 7 + i / 251);
+    }
+    for (std::vector<int64_t> perm : {std::vector<int64_t>{2, 0, 1}, std::vector<int64_t>{1, 2, 0}}) {
+      const int64_t shape[3] = {3, 40, 50};
+      const int64_t strides[3] = {40 * 50, 50, 1};
+      std::vector<int64_t> new_shape, new_strides;
+      for (int64_t axis : perm) {
+        new_shape.push_back(shape[axis]);
+        new_strides.push_back(strides[axis]);
+      }
+      std::vector<uint8_t> expected;
+      for (int64_t i = 0; i < new_shape[0]; ++i) {
+        for (int64_t j = 0; j < new_shape[1]; ++j) {
+          for (int64_t k = 0; k < new_shape[2]; ++k) {
+            const uint8_t *src = &data[(i * new_strides[0] + j * new_strides[1] + k * new_strides[2]) * elem_size];
+            expected.insert(expected.end(), src, src + elem_size);
+          }
+        }
+      }
+      Tensor permuted = MakeTensor(data.data(), dtype, new_shape, new_strides);
+      Tensor contiguous = MakeTensor(expected.data(), dtype, new_shape, {});
+      std::string bytes = ToBytes(contiguous);
+      EXPECT_EQ(ToBytes(permuted), bytes);
+      for (int64_t chunk_size : {1, 5, 64, 4099, 1 << 20}) {
+        std::vector<int64_t> chunk_sizes;
+        EXPECT_EQ(ToBytesChunked(permuted, chunk_size, &chunk_sizes), bytes);
+        for (size_t i = 0; i + 1 < chunk_sizes.size(); ++i) {
+          EXPECT_EQ(chunk_sizes[i], chunk_size);
+        }
+      }
+    }
+  }
+}
+
+TEST(Tensor, ToBytesDevice) {
+  int64_t num_copies = 0;
+  DLDevice device = TestDevice(&num_copies);
+  std::vector<float> data(6 * 9);
+  std::iota(data.begin(), data.end(), 0.5f);
+  Tensor host = MakeTensor(data.data(), {kDLFloat, 32, 1}, {6, 9}, {});
+  Tensor dev = MakeTensor(data.data(), {kDLFloat, 32, 1}, {6, 9}, {}, device);
+  EXPECT_EQ(ToBytes(dev), ToBytes(host));
+  EXPECT_EQ(num_copies, 1);
+  // Compact payloads are fetched chunk by chunk
+  std::vector<int64_t> chunk_sizes;
+  EXPECT_EQ(ToBytesChunked(dev, 64, &chunk_sizes), ToBytes(host));
+  EXPECT_GT(num_copies, 3);
+  // Strided payloads are fetched at once
+  num_copies = 0;
+  Tensor host_t = MakeTensor(data.data(), {kDLFloat, 32, 1}, {9, 6}, {1, 9});
+  Tensor dev_t = MakeTensor(data.data(), {kDLFloat, 32, 1}, {9, 6}, {1, 9}, device);
+  EXPECT_EQ(ToBytes(dev_t), ToBytes(host_t));
+  EXPECT_EQ(num_copies, 1);
+}
+
+TEST(Tensor, ToBytesNoDeviceCopy) {
+  float data[4] = {0, 1, 2, 3};
+  Tensor tensor = MakeTensor(data, {kDLFloat, 32, 1}, {4}, {}, DLDevice{kDLVulkan, 0});
+  try {
+    tensor->ToBytes();
+    FAIL() << "No exception thrown";
+  } catch (Exception &e) {
+    EXPECT_STREQ(e.what(), "Cannot copy tensor data from device `vulkan:0` to host. Register function "
+                           "`mlc.core.DeviceCopyToHost.vulkan` to enable it");
+  }
+}
+
+TEST(Tensor, StructuralEqualContent) {
+  int64_t num_copies = 0;
+  DLDevice device = TestDevice(&num_copies);
+  std::vector<int16_t> data(8 * 16);
+  std::iota(data.begin(), data.end(), 0);
+  std::vector<int16_t> transposed;
+  for (int i = 0; i < 16; ++i) {
+    for (int j = 0; j < 8; ++j) {
+      transposed.push_back(data[j * 16 + i]);
+    }
+  }
+  Tensor a = MakeTensor(data.data(), {kDLInt, 16, 1}, {16, 8}, {1, 16}, device);
+  Tensor b = MakeTensor(transposed.data(), {kDLInt, 16, 1}, {16, 8}, {}, device);
+  EXPECT_FALSE(Lib::StructuralEqual(a, b, true, false, false));
+  EXPECT_TRUE(Lib::StructuralEqual(a, b, true, false, true));
+  EXPECT_EQ(Lib::StructuralHash(a, true), Lib::StructuralHash(b, true));
+  transposed[37] += 1;
+  Tensor c = MakeTensor(transposed.data(), {kDLInt, 16, 1}, {16, 8}, {}, device);
+  EXPECT_FALSE(Lib::StructuralEqual(a, c, true, false, true));
+  EXPECT_NE(Lib::StructuralHash(a, true), Lib::StructuralHash(c, true));
+  // Tensors over external memory observe writes in place
+  EXPECT_NE(Lib::StructuralHash(a, true), Lib::StructuralHash(b, true));
+  try {
+    Lib::StructuralEqual(a, c, true, true, true);
+    FAIL() << "No exception thrown";
+  } catch (Exception &e) {
+    EXPECT_STREQ(e.what(), "Structural equality check failed at {root}.data: Tensor data mismatch at element 37");
+  }
+}
+
+TEST(Tensor, ContentHashAfterWrite) {
+  std::vector<int32_t> data(24);
+  std::iota(data.begin(), data.end(), 0);
+  Tensor a = MakeTensor(data.data(), {kDLInt, 32, 1}, {4, 6}, {});
+  Tensor b = Tensor::FromBytes(a->ToBytes());
+  EXPECT_EQ(Lib::StructuralHash(a, true), Lib::StructuralHash(b, true));
+  static_cast<int32_t *>(b->tensor.data)[5] += 1;
+  EXPECT_NE(Lib::StructuralHash(a, true), Lib::StructuralHash(b, true));
+}
+
+TEST(Tensor, StructuralEqualContentFloat) {
+  float lhs[4] = {0.0f, 1.0f, 2.0f, 3.0f};
+  float rhs[4] = {0.0f, 1.0f, std::nextafter(2.0f, 3.0f), 3.0f};
+  float other[4] = {0.0f, 1.0f, 2.5f, 3.0f};
+  Tensor a = MakeTensor(lhs, {kDLFloat, 32, 1}, {4}, {});
+  EXPECT_TRUE(Lib::StructuralEqual(a, MakeTensor(rhs, {kDLFloat, 32, 1}, {4}, {}), true, false, true));
+  EXPECT_FALSE(Lib::StructuralEqual(a, MakeTensor(other, {kDLFloat, 32, 1}, {4}, {}), true, false, true));
+  // Bitwise for other dtypes
+  EXPECT_FALSE(Lib::StructuralEqual(MakeTensor(lhs, {kDLUInt, 32, 1}, {4}, {}),
+                                    MakeTensor(rhs, {kDLUInt, 32, 1}, {4}, {}), true, false, true));
+}
+
+TEST(Tensor, SerializeDedup) {
+  static FuncObj *serialize = Lib::FuncGetGlobal("mlc.core.JSONSerializeWithOptions");
+  static FuncObj *deserialize = Lib::FuncGetGlobal("mlc.core.JSONDeserialize");
+  static FuncObj *json_loads = Lib::FuncGetGlobal("mlc.core.JSONLoads");
+  auto num_payloads = [](const Str &json) -> int64_t {
+    UDict parsed = (*json_loads)(json);
+    return parsed->count("tensors") ? UList(parsed->at("tensors"))->size() : 0;
+  };
+  std::vector<int32_t> data(6 * 4);
+  std::iota(data.begin(), data.end(), 0);
+  std::vector<int32_t> copy = data;
+  // Distinct objects viewing the same bytes
+  Tensor a = MakeTensor(data.data(), {kDLInt, 32, 1}, {6, 4}, {});
+  Tensor b = MakeTensor(data.data(), {kDLInt, 32, 1}, {6, 4}, {4, 1});
+  // Same bytes, different views
+  Tensor c = MakeTensor(data.data(), {kDLInt, 32, 1}, {4, 6}, {1, 4});
+  // Same contents, different bytes
+  Tensor d = MakeTensor(copy.data(), {kDLInt, 32, 1}, {6, 4}, {});
+  UList list{a, b, c, d};
+  Str json = (*serialize)(list, false);
+  EXPECT_EQ(num_payloads(json), 3);
+  EXPECT_EQ(num_payloads((*serialize)(list, true)), 2);
+  EXPECT_EQ((*Lib::FuncGetGlobal("mlc.core.JSONSerialize"))(list).operator Str(), json);
+  UList loaded = (*deserialize)(json);
+  EXPECT_EQ(loaded[0].operator Object *(), loaded[1].operator Object *());
+  EXPECT_NE(loaded[0].operator Object *(), loaded[3].operator Object *());
+  EXPECT_TRUE(Lib::StructuralEqual(list, loaded, true, false, true));
+  // Contents within tolerance are not merged
+  float x[2] = {1.0f, 2.0f};
+  float y[2] = {1.0f, std::nextafter(2.0f, 3.0f)};
+  UList floats{MakeTensor(x, {kDLFloat, 32, 1}, {2}, {}), MakeTensor(y, {kDLFloat, 32, 1}, {2}, {})};
+  EXPECT_EQ(num_payloads((*serialize)(floats, true)), 2);
+}
+
+TEST(Tensor, Empty) {
+  static FuncObj *pool_stats = Lib::FuncGetGlobal("mlc.core.TensorPoolStats");
+  auto stat = [](const char *key) -> int64_t { return UDict((*pool_stats)())->at(key); };
+  Tensor a = Tensor::Empty({4, 0, 3}, {kDLInt, 8, 1});
+  EXPECT_EQ(a.ndim(), 3);
+  EXPECT_EQ(a.shape()[1], 0);
+  EXPECT_EQ(a.shape()[3], -1);
+  EXPECT_EQ(a.strides(), nullptr);
+  int64_t hits = stat("num_cache_hits");
+  for (int i = 0; i < 4; ++i) {
+    Tensor b = Tensor::Empty({17, 33}, {kDLFloat, 64, 1});
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(b.data()) % 64, 0);
+    std::memset(b->tensor.data, 0xFF, 17 * 33 * sizeof(double));
+    EXPECT_EQ(b.shape()[0], 17);
+    EXPECT_EQ(b.shape()[1], 33);
+  }
+  EXPECT_GE(stat("num_cache_hits") - hits, 3);
+  try {
+    Tensor::Empty({2, -1}, {kDLFloat, 32, 1});
+    FAIL() << "No exception thrown";
+  } catch (Exception &e) {
+    EXPECT_STREQ(e.what(), "Invalid shape: dimension 1 has negative extent -1");
+  }
+}
+
+TEST(Tensor, EmptyDevice) {
+  float data[6] = {};
+  static int64_t num_allocs = 0;
+  static int64_t num_frees = 0;
+  Lib::DeviceTypeRegister("mlc_test_alloc_device");
+  DLDevice device{static_cast<DLDeviceType>(Lib::DeviceTypeFromStr("mlc_test_alloc_device")), 0};
+  try {
+    Tensor::Empty({2, 3}, {kDLFloat, 32, 1}, device);
+    FAIL() << "No exception thrown";
+  } catch (Exception &e) {
+    EXPECT_STREQ(e.what(), "Cannot allocate tensor on device `mlc_test_alloc_device:0`. Register functions "
+                           "`mlc.core.DeviceAlloc.mlc_test_alloc_device` and "
+                           "`mlc.core.DeviceFree.mlc_test_alloc_device` to enable it");
+  }
+  static float *storage = data;
+  Lib::FuncSetGlobal("mlc.core.DeviceAlloc.mlc_test_alloc_device", Func([](int64_t num_bytes, DLDevice) -> void * {
+                                                                       EXPECT_EQ(num_bytes, 6 * sizeof(float));
+                                                                       ++num_allocs;
+                                                                       return storage;
+                                                                     }).get());
+  Lib::FuncSetGlobal("mlc.core.DeviceFree.mlc_test_alloc_device", Func([](void *ptr, DLDevice) {
+                                                                      EXPECT_EQ(ptr, storage);
+                                                                      ++num_frees;
+                                                                    }).get());
+  {
+    Tensor a = Tensor::Empty({2, 3}, {kDLFloat, 32, 1}, device);
+    EXPECT_EQ(a.data(), data);
+    EXPECT_EQ(num_allocs, 1);
+    EXPECT_EQ(num_frees, 0);
+  }
+  EXPECT_EQ(num_frees, 1);
+}
+
+} // namespace
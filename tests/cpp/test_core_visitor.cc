@@ -0,0 +1,78 @@
+#include "./common.h"
+#include <gtest/gtest.h>
+#include <mlc/core/all.h>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using namespace mlc;
+using mlc::core::TopoVisit;
+using mlc::core::TopoVisitLevels;
+using mlc::core::TopoVisitScratch;
+
+Object *ObjPtr(AnyView v) { return v.operator Object *(); }
+
+// root -> {a, b, a}, a -> {leaf}, b -> {leaf, "str"}
+UList MakeDiamond() {
+  UList leaf{1, 2};
+  UList a{leaf};
+  UList b{leaf, Str("str")};
+  return UList{a, b, a};
+}
+
+TEST(TopoVisit, ChildrenBeforeParents) {
+  UList root = MakeDiamond();
+  std::unordered_map<Object *, int> order;
+  TopoVisit(ObjPtr(root), nullptr, [&](Object *obj, MLCTypeInfo *) {
+    EXPECT_EQ(order.count(obj), 0);
+    order[obj] = static_cast<int>(order.size());
+  });
+  UList a = root[0], b = root[1], leaf = a[0];
+  EXPECT_EQ(order.size(), 5);
+  EXPECT_LT(order.at(ObjPtr(leaf)), order.at(ObjPtr(a)));
+  EXPECT_LT(order.at(ObjPtr(leaf)), order.at(ObjPtr(b)));
+  EXPECT_LT(order.at(ObjPtr(a)), order.at(ObjPtr(root)));
+  EXPECT_LT(order.at(ObjPtr(b)), order.at(ObjPtr(root)));
+  EXPECT_EQ(order.at(ObjPtr(root)), 4);
+}
+
+TEST(TopoVisit, PreVisitBFS) {
+  UList root = MakeDiamond();
+  std::vector<Object *> visited;
+  TopoVisit(ObjPtr(root), [&](Object *obj, MLCTypeInfo *) { visited.push_back(obj); }, nullptr);
+  UList a = root[0], b = root[1], leaf = a[0];
+  std::vector<Object *> expected{ObjPtr(root), ObjPtr(a), ObjPtr(b), ObjPtr(leaf), ObjPtr(b[1])};
+  EXPECT_EQ(visited, expected);
+}
+
+TEST(TopoVisit, ReuseScratch) {
+  TopoVisitScratch scratch;
+  for (int i = 0; i < 3; ++i) {
+    UList root = MakeDiamond();
+    for (int j = 0; j < i * 100; ++j) {
+      root.push_back(UList{j});
+    }
+    int num_visited = 0;
+    TopoVisit(ObjPtr(root), nullptr, [&](Object *, MLCTypeInfo *) { ++num_visited; }, &scratch);
+    EXPECT_EQ(num_visited, 5 + i * 100);
+  }
+}
+
+TEST(TopoVisit, Levels) {
+  UList root = MakeDiamond();
+  std::vector<size_t> level_sizes;
+  TopoVisitLevels(ObjPtr(root), nullptr, [&](const std::vector<std::pair<Object *, MLCTypeInfo *>> &level) {
+    level_sizes.push_back(level.size());
+  });
+  EXPECT_EQ(level_sizes, (std::vector<size_t>{2, 2, 1}));
+}
+
+TEST(TopoVisit, CircularDependency) {
+  UList root{1};
+  root.push_back(root);
+  EXPECT_THROW(TopoVisit(ObjPtr(root), nullptr, [](Object *, MLCTypeInfo *) {}), Exception);
+  root.clear();
+}
+
+} // namespace
@@ -1,7 +1,12 @@
+from pathlib import Path
+from typing import Any
+
 import mlc
 import mlc.dataclasses as mlcd
 import pytest
+from mlc import config as mlc_config
 from mlc._cython import SYSTEM
+from mlc.cc import compiler, jit
 
 
 @pytest.mark.xfail(
@@ -52,3 +57,83 @@ def test_jit_load() -> None:
     with pytest.raises(AttributeError):
         obj.y = 42
     del obj
+
+
+@pytest.mark.xfail(
+    condition=SYSTEM == "Windows",
+    reason="`vcvarsall.bat` not found for some reason",
+)
+def test_jit_load_cache(tmp_path: Path, monkeypatch: pytest.MonkeyPatch) -> None:
+    source = """
+    #define MLC_JIT_EXPORTS 1
+    #include <mlc/core/all.h>
+
+    MLC_REGISTER_FUNC("mlc.testing.jit_cached").set_body([](int x) { return x * 2; });
+    """
+    monkeypatch.setenv("MLC_JIT_CACHE_DIR", str(tmp_path))
+    mlc.cc.jit_load(source)
+    assert mlc.Func.get("mlc.testing.jit_cached")(21) == 42
+    (lib,) = tmp_path.iterdir()
+
+    def _no_compile(*args: Any, **kwargs: Any) -> None:
+        raise AssertionError("Should not recompile")
+
+    monkeypatch.setattr(jit, "create_shared", _no_compile)
+    mlc.cc.jit_load(source)
+    monkeypatch.setattr(jit, "_LOADED", set())
+    mlc.cc.jit_load(source)
+    assert list(tmp_path.iterdir()) == [lib]
+
+
+@pytest.mark.xfail(
+    condition=SYSTEM == "Windows",
+    reason="`vcvarsall.bat` not found for some reason",
+)
+def test_jit_load_multiple_sources() -> None:
+    mlc.cc.jit_load(
+        [
+            """
+            #include <mlc/core/all.h>
+            int32_t JitSquare(int32_t x) { return x * x; }
+            """,
+            """
+            #include <mlc/core/all.h>
+            int32_t JitSquare(int32_t x);
+            MLC_REGISTER_FUNC("mlc.testing.jit_square_plus_one").set_body([](int32_t x) {
+              return JitSquare(x) + 1;
+            });
+            """,
+        ],
+        cache=False,
+    )
+    assert mlc.Func.get("mlc.testing.jit_square_plus_one")(7) == 50
+
+
+@pytest.mark.skipif(SYSTEM == "Windows", reason="Precompiled headers are not used on Windows")
+def test_jit_load_precompiled_header(tmp_path: Path, monkeypatch: pytest.MonkeyPatch) -> None:
+    monkeypatch.setattr(mlc_config, "cachedir", lambda: tmp_path)
+    mlc.cc.jit_load(
+        """
+        #include <mlc/core/all.h>
+        MLC_REGISTER_FUNC("mlc.testing.jit_pch").set_body([](int x) { return x + 1; });
+        """,
+        cache=False,
+        precompiled_header=True,
+    )
+    assert mlc.Func.get("mlc.testing.jit_pch")(1) == 2
+    assert list(tmp_path.glob("pch/*/mlc_pch.h.*ch"))
+
+
+@pytest.mark.skipif(SYSTEM == "Windows", reason="Precompiled headers are not used on Windows")
+def test_precompiled_header_failure_cached(tmp_path: Path, monkeypatch: pytest.MonkeyPatch) -> None:
+    monkeypatch.setattr(mlc_config, "cachedir", lambda: tmp_path)
+    monkeypatch.setattr(compiler, "PCH_HEADERS", ("mlc/does_not_exist.h",))
+    args = (mlc_config.probe_compiler()[0], ["-std=c++17"], [], {})
+    with pytest.warns(UserWarning, match="Failed to build precompiled header"):
+        assert compiler._linux_precompiled_header(*args) is None
+
+    def _no_run(*args: Any, **kwargs: Any) -> None:
+        raise AssertionError("Should not retry")
+
+    monkeypatch.setattr(compiler, "_linux_run", _no_run)
+    assert compiler._linux_precompiled_header(*args) is None
@@ -0,0 +1,77 @@
+import mlc
+import mlc.dataclasses as mlcd
+
+
+@mlcd.py_class("mlc.testing.intern.Const", structure="nobind")
+class Const(mlcd.PyClass):
+    value: int
+
+
+@mlcd.py_class("mlc.testing.intern.Add", structure="nobind")
+class Add(mlcd.PyClass):
+    a: mlc.Object
+    b: mlc.Object
+
+
+@mlcd.py_class("mlc.testing.intern.Var", structure="var")
+class Var(mlcd.PyClass):
+    name: str = mlcd.field(structure=None)
+
+
+def test_intern() -> None:
+    table = mlc.StructuralInternTable()
+    a = Add(Const(1), Const(2))
+    b = Add(Const(1), Const(2))
+    assert table.intern(a).eq_ptr(a)
+    assert table.intern(b).eq_ptr(a)
+    assert table.lookup(Add(Const(2), Const(1))) is None
+    assert len(table) == 1
+    assert table.intern(1) == 1
+
+
+def test_intern_graph() -> None:
+    table = mlc.StructuralInternTable()
+    x = Add(Const(1), Const(2))
+    y = Add(Const(1), Const(2))
+    root = mlc.List([Add(x, y), {"k": Add(Const(1), Const(2))}])
+    canonical = table.intern_graph(root)
+    assert len(canonical) == 12
+    assert canonical[y].eq_ptr(x)
+    assert canonical[root[1]["k"]].eq_ptr(x)
+    assert canonical[x.a].eq_ptr(canonical[y.a])
+    assert not canonical[x.a].eq_ptr(canonical[x.b])
+    assert len(table) == 6
+    assert table.lookup(Add(Const(1), Const(2))).eq_ptr(x)
+
+
+def test_intern_graph_deep_copy() -> None:
+    def chain(n: int, last: int) -> mlc.List:
+        x = mlc.List([last])
+        for i in range(n):
+            x = mlc.List([x, Const(i)])
+        return x
+
+    table = mlc.StructuralInternTable()
+    x = chain(2000, 0)
+    table.intern_graph(x)
+    y = chain(2000, 0)
+    canonical = table.intern_graph(y)
+    assert canonical[y].eq_ptr(x)
+    assert canonical[y[0]].eq_ptr(x[0])
+    z = chain(2000, 1)
+    assert not table.intern_graph(z)[z].eq_ptr(x)
+    assert len(table) == 2 * 2001 + 2000
+
+
+def test_intern_graph_vars() -> None:
+    table = mlc.StructuralInternTable(bind_free_vars=True)
+    v1, v2, v3 = Var("v1"), Var("v2"), Var("v3")
+    x = Add(Add(v1, v2), Const(1))
+    y = Add(Add(v3, v3), Const(1))
+    table.intern_graph(x)
+    canonical = table.intern_graph(y)
+    assert not canonical[y].eq_ptr(x)
+    assert not canonical[y.a].eq_ptr(x.a)
+    assert canonical[y.b].eq_ptr(x.b)
+    w = Add(Add(v3, Var("v4")), Const(1))
+    assert table.intern_graph(w)[w].eq_ptr(x)
@@ -14,3 +14,27 @@ def test_object_swap() -> None:
     a.swap(b)
     assert a._mlc_address == b_addr
     assert b._mlc_address == a_addr
+
+
+def test_object_identity_cache() -> None:
+    a = mlc.Object()
+    b = mlc.Object()
+    lst = mlc.List([a, b])
+    assert lst[0] is not lst[0]
+    prev = mlc.set_identity_cache_enabled(True)
+    try:
+        assert prev is False
+        lst = mlc.List([a, b])
+        assert lst[0] is a
+        assert lst[1] is b
+        c = mlc.List([lst])[0]
+        assert c is lst
+        a.swap(b)
+        assert lst[0] is not b
+        assert lst[0].eq_ptr(b)
+        assert lst[0] is lst[0]
+        del a, b, c
+        assert lst[0] is lst[0]
+    finally:
+        assert mlc.set_identity_cache_enabled(prev) is True
+    assert lst[0] is not lst[0]
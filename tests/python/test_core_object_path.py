@@ -35,3 +35,38 @@ def test_with_dict_key() -> None:
     obj = mlc.ObjectPath.root().with_dict_key("key")
     assert obj.kind == 2
     assert str(obj) == '{root}["key"]'
+
+
+def test_equal() -> None:
+    root = mlc.ObjectPath.root()
+    assert root["a"][0].equal(mlc.ObjectPath.root()["a"][0])
+    assert not root["a"][0].equal(root["a"][1])
+    assert not root["a"][0].equal(root["b"][0])
+    assert not root["a"].equal(root.with_dict_key("a"))
+
+
+def test_is_prefix_of() -> None:
+    root = mlc.ObjectPath.root()
+    assert root.is_prefix_of(root["a"][0])
+    assert root["a"].is_prefix_of(mlc.ObjectPath.root()["a"][0])
+    assert root["a"][0].is_prefix_of(root["a"][0])
+    assert not root["a"][0].is_prefix_of(root["a"])
+    assert not root["b"].is_prefix_of(root["a"][0])
+
+
+def test_equal_to_copy() -> None:
+    path = mlc.ObjectPath.root()["a"][0]
+    copied = path.copy_deep()
+    assert copied.equal(path)
+    assert path.equal(copied)
+    assert copied.is_prefix_of(path["b"])
+    assert str(copied[1]) == "{root}.a[0][1]"
+
+
+def test_interned_root() -> None:
+    root = mlc.ObjectPath.interned_root()
+    a = root["a"][0]
+    assert a.eq_ptr(root["a"][0])
+    assert not mlc.ObjectPath.root()["a"].eq_ptr(mlc.ObjectPath.root()["a"])
+    assert a.equal(mlc.ObjectPath.root()["a"][0])
+    assert str(a) == "{root}.a[0]"
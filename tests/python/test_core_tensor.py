@@ -1,3 +1,5 @@
+import base64
+
 import mlc
 import numpy as np
 import pytest
@@ -111,6 +113,24 @@ def test_tensor_base64_float16() -> None:
     assert torch.equal(a.torch(), b.torch())
 
 
+@pytest.mark.parametrize("size", [1, 2, 3, 23, 24, 25, 31, 32, 33, 95, 96, 97, 1000, 4099])
+def test_tensor_base64_sizes(size: int) -> None:
+    rng = np.random.default_rng(size)
+    a = mlc.Tensor(rng.integers(0, 256, size=size, dtype=np.uint8))
+    s = a.base64()
+    assert base64.b64encode(base64.b64decode(s)).decode() == s
+    b = mlc.Tensor.from_base64(s)
+    assert a.shape == b.shape
+    assert np.array_equal(a.numpy(), b.numpy())
+
+
+def test_tensor_base64_invalid() -> None:
+    s = mlc.Tensor(np.zeros(96, dtype=np.uint8)).base64()
+    for pos in [0, 17, len(s) // 2, len(s) - 3]:
+        with pytest.raises(ValueError, match="Invalid character"):
+            mlc.Tensor.from_base64(s[:pos] + "!" + s[pos + 1 :])
+
+
 def test_torch_strides() -> None:
     a = torch.empty(4, 1, 6, 1, 10, dtype=torch.int16)
     a = torch.from_dlpack(torch.to_dlpack(a))
@@ -118,6 +138,69 @@ def test_torch_strides() -> None:
     assert b.strides is None
 
 
+def test_tensor_base64_strided() -> None:
+    a = torch.arange(60, dtype=torch.float32).reshape(3, 4, 5).permute(2, 0, 1)
+    b = mlc.Tensor(a)
+    assert b.strides == (1, 20, 5)
+    c = mlc.Tensor.from_base64(b.base64())
+    assert c.shape == (5, 3, 4)
+    assert c.strides is None
+    assert c.base64() == mlc.Tensor(a.contiguous()).base64()
+    assert torch.equal(c.torch(), a)
+
+
+def test_tensor_eq_s_content() -> None:
+    a = mlc.Tensor(np.arange(24, dtype=np.int32).reshape(4, 6))
+    b = mlc.Tensor(np.arange(24, dtype=np.int32).reshape(4, 6))
+    c = mlc.Tensor(np.arange(1, 25, dtype=np.int32).reshape(4, 6))
+    assert a.eq_s(c)
+    assert a.hash_s() == c.hash_s()
+    assert mlc.List([a]).eq_s(mlc.List([b]), tensor_content=True)
+    assert not mlc.List([a]).eq_s(mlc.List([c]), tensor_content=True)
+    assert mlc.List([a]).hash_s(tensor_content=True) == mlc.List([b]).hash_s(tensor_content=True)
+    assert mlc.List([a]).hash_s(tensor_content=True) != mlc.List([c]).hash_s(tensor_content=True)
+    reason = mlc.List([a]).eq_s_fail_reason(mlc.List([c]), tensor_content=True)
+    assert "Tensor data mismatch at element 0" in str(reason)
+
+
+def test_tensor_hash_s_content_in_place() -> None:
+    x = np.arange(24, dtype=np.int32)
+    a = mlc.Tensor(x)
+    b = mlc.Tensor(np.arange(24, dtype=np.int32))
+    assert a.hash_s(tensor_content=True) == b.hash_s(tensor_content=True)
+    x[3] = 100
+    assert not a.eq_s(b, tensor_content=True)
+    assert a.hash_s(tensor_content=True) != b.hash_s(tensor_content=True)
+
+
+def test_tensor_eq_s_content_layout() -> None:
+    x = torch.arange(24, dtype=torch.float32).reshape(4, 6)
+    a = mlc.Tensor(x.t())
+    b = mlc.Tensor(x.t().contiguous())
+    assert a.strides != b.strides
+    assert not mlc.List([a]).eq_s(mlc.List([b]))
+    assert mlc.List([a]).eq_s(mlc.List([b]), tensor_content=True)
+    assert mlc.List([a]).hash_s(tensor_content=True) == mlc.List([b]).hash_s(tensor_content=True)
+
+
+def test_tensor_eq_s_content_tolerance() -> None:
+    a = mlc.Tensor(np.array([1.0, 2.0, np.nan], dtype=np.float64))
+    b = mlc.Tensor(np.array([1.0, 2.0 + 1e-10, np.nan], dtype=np.float64))
+    c = mlc.Tensor(np.array([1.0, 2.0 + 1e-3, np.nan], dtype=np.float64))
+    assert mlc.List([a]).eq_s(mlc.List([b]), tensor_content=True)
+    assert not mlc.List([a]).eq_s(mlc.List([c]), tensor_content=True)
+
+
+def test_tensor_to_bytes_chunked() -> None:
+    a = mlc.Tensor(np.arange(300, dtype=np.float32))
+    chunks: list[bytes] = []
+    a.to_bytes_chunked(64, chunks.append)
+    assert all(isinstance(chunk, bytes) for chunk in chunks)
+    assert [len(chunk) for chunk in chunks[:-1]] == [64] * (len(chunks) - 1)
+    assert 0 < len(chunks[-1]) <= 64
+    assert b"".join(chunks) == base64.b64decode(a.base64())
+
+
 def test_tensor_serialize() -> None:
     a = mlc.Tensor(np.arange(24, dtype=np.int16).reshape(2, 3, 4))
     a_json = mlc.List([a, a]).json()
@@ -128,3 +211,51 @@ def test_tensor_serialize() -> None:
     assert isinstance(b[1], mlc.Tensor)
     assert b[0].eq_ptr(b[1])
     assert np.array_equal(a.numpy(), b[0].numpy())
+
+
+def test_tensor_serialize_dedup() -> None:
+    x = np.arange(24, dtype=np.float32).reshape(4, 6)
+    a = mlc.Tensor(x)
+    b = mlc.Tensor(x)
+    c = mlc.Tensor(x.copy())
+    assert not a.eq_ptr(b)
+    a_json = mlc.List([a, b, c]).json()
+    assert len(mlc.json_loads(a_json)["tensors"]) == 2
+    assert len(mlc.json_loads(mlc.List([a, b, c]).json(dedup_tensor_content=True))["tensors"]) == 1
+    d = mlc.List.from_json(a_json)
+    assert d[0].eq_ptr(d[1])
+    assert not d[0].eq_ptr(d[2])
+    assert np.array_equal(d[2].numpy(), x)
+
+
+def test_tensor_empty() -> None:
+    a = mlc.Tensor.empty((3, 5), "float32")
+    assert a.shape == (3, 5)
+    assert a.dtype == mlc.DataType("float32")
+    assert a.device == mlc.Device("cpu")
+    assert a.strides is None
+    assert a.data.value % 64 == 0
+    x = np.arange(15, dtype=np.float32).reshape(3, 5)
+    a.numpy()[:] = x
+    assert np.array_equal(a.numpy(), x)
+    assert np.array_equal(mlc.Tensor.from_base64(a.base64()).numpy(), x)
+
+
+def test_tensor_empty_too_large() -> None:
+    with pytest.raises(ValueError, match="Tensor is too large"):
+        mlc.Tensor.empty((1 << 31, 1 << 31, 1 << 2), "float64")
+    assert mlc.Tensor.empty((1 << 40, 1 << 40, 0), "float64").shape == (1 << 40, 1 << 40, 0)
+
+
+def test_tensor_pool_reuse() -> None:
+    s = mlc.Tensor(np.arange(1000, dtype=np.int64)).base64()
+    mlc.Tensor.from_base64(s)
+    before = mlc.Tensor.pool_stats()
+    for _ in range(10):
+        mlc.Tensor.from_base64(s)
+    after = mlc.Tensor.pool_stats()
+    assert after["num_allocs"] - before["num_allocs"] == 10
+    assert after["num_cache_hits"] - before["num_cache_hits"] == 10
+    assert after["bytes_in_use"] == before["bytes_in_use"]
+    mlc.Tensor.pool_release()
+    assert mlc.Tensor.pool_stats()["bytes_cached"] == 0
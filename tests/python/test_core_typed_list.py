@@ -0,0 +1,115 @@
+import pytest
+from mlc import List, Object, TypedList
+from mlc._cython import typed_list_buffer
+
+
+def test_typed_list_init_int64() -> None:
+    a = TypedList([1, 2, 3])
+    assert str(a.dtype) == "int64"
+    assert len(a) == 3
+    assert list(a) == [1, 2, 3]
+    assert str(a) == "TypedList[int64](1, 2, 3)"
+
+
+def test_typed_list_init_float64() -> None:
+    a = TypedList([1.5, 2.5], dtype="float64")
+    assert str(a.dtype) == "float64"
+    assert list(a) == [1.5, 2.5]
+
+
+def test_typed_list_init_bool() -> None:
+    a = TypedList([True, False, True], dtype="bool")
+    assert list(a) == [True, False, True]
+
+
+def test_typed_list_unsupported_dtype() -> None:
+    with pytest.raises(TypeError) as e:
+        TypedList([1, 2], dtype="int32")
+    assert str(e.value) == "TypedList only supports `int64`, `float64` and `bool`, but got: int32"
+
+
+def test_typed_list_getitem_setitem() -> None:
+    a = TypedList([1, 2, 3])
+    assert a[-1] == 3
+    a[0] = 10
+    assert list(a) == [10, 2, 3]
+    assert list(a[::2]) == [10, 3]
+    with pytest.raises(IndexError):
+        a[3]
+
+
+def test_typed_list_append_extend() -> None:
+    a = TypedList[float](dtype="float64")
+    a.append(1.0)
+    a.extend([2.0, 3.0])
+    assert list(a) == [1.0, 2.0, 3.0]
+    assert a.capacity >= a.size == 3
+
+
+def test_typed_list_to_from_list() -> None:
+    a = TypedList.from_list(List([1, 2, 3]), dtype="int64")
+    b = a.to_list()
+    assert isinstance(b, List)
+    assert list(b) == [1, 2, 3]
+
+
+def test_typed_list_memoryview() -> None:
+    a = TypedList([1, 2, 3])
+    view = typed_list_buffer(a)
+    assert view.format == "q"
+    assert view.tolist() == [1, 2, 3]
+    assert view.readonly
+    a[1] = 20
+    assert view.tolist() == [1, 20, 3]
+
+
+def test_typed_list_memoryview_blocks_resize() -> None:
+    a = TypedList([1, 2, 3])
+    view = typed_list_buffer(a)
+    with pytest.raises(BufferError):
+        a.append(4)
+    with memoryview(view) as nested:
+        assert nested.tolist() == [1, 2, 3]
+    with pytest.raises(BufferError):
+        a.append(4)
+    view.release()
+    a.append(4)
+    assert list(a) == [1, 2, 3, 4]
+
+
+def test_typed_list_numpy() -> None:
+    np = pytest.importorskip("numpy")
+    a = TypedList([1.0, 2.0], dtype="float64")
+    arr = a.numpy()
+    assert arr.dtype == np.float64
+    assert arr.tolist() == [1.0, 2.0]
+
+
+def test_typed_list_structural_eq_hash() -> None:
+    a = TypedList([1.0, 2.5], dtype="float64")
+    b = TypedList([1.0, 2.5], dtype="float64")
+    assert a.eq_s(b)
+    assert a.hash_s() == b.hash_s()
+    c = TypedList([1, 2])
+    d = TypedList([1, 3])
+    assert not c.eq_s(d)
+    with pytest.raises(ValueError) as e:
+        c.eq_s(d, assert_mode=True)
+    assert str(e.value) == "Structural equality check failed at {root}[1]: 2 vs 3"
+    assert str(e.value) == c.eq_s_fail_reason(d)
+
+
+def test_typed_list_copy() -> None:
+    a = List([TypedList([1, 2]), TypedList([True], dtype="bool")])
+    b = a.__deepcopy__({})
+    assert not b[0].eq_ptr(a[0])
+    assert a.eq_s(b)
+
+
+def test_typed_list_json() -> None:
+    a = List(
+        [TypedList([1, 2]), TypedList([0.5], dtype="float64"), TypedList([False], dtype="bool")]
+    )
+    b = Object.from_json(a.json())
+    assert a.eq_s(b)
+    assert list(b[0]) == [1, 2]
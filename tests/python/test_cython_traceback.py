@@ -74,3 +74,17 @@ def test_throw_NotImplementedError_from_ffi_in_c() -> None:
 
     with pytest.raises(NotImplementedError):
         mlc.Func.get("mlc.testing.throw_exception_from_ffi_in_c")(throw_ValueError)
+
+
+def test_throw_exception_traceback_disabled() -> None:
+    func = mlc.Func.get("mlc.testing.throw_exception_from_c")
+    prev = mlc.set_traceback_enabled(False)
+    try:
+        with pytest.raises(ValueError) as exc_info:
+            func()
+    finally:
+        assert mlc.set_traceback_enabled(prev) is False
+    msg = traceback.format_exception(exc_info.type, exc_info.value, exc_info.tb)
+    msg = "".join(msg).strip().splitlines()
+    assert "ValueError: This is an error message" in msg[-1]
+    assert "c_api.cc" in msg[-3]
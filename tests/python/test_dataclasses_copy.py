@@ -15,6 +15,24 @@ class CustomInit(mlc.PyClass):
         self.b = b
 
 
+@mlc.py_class(frozen=True, structure="nobind")
+class FrozenLeaf(mlc.PyClass):
+    a: int
+    b: str
+
+
+@mlc.py_class(frozen=True, structure="nobind")
+class FrozenPair(mlc.PyClass):
+    lhs: FrozenLeaf
+    rhs: mlc.Object
+
+
+@mlc.py_class(structure="nobind")
+class MutablePair(mlc.PyClass):
+    lhs: FrozenLeaf
+    rhs: mlc.Object
+
+
 @pytest.fixture
 def test_obj() -> CustomInit:
     return CustomInit(a=1, b="hello")
@@ -282,3 +300,70 @@ def test_copy_replace_dataclass(test_obj: CustomInit) -> None:
     assert src.b == "hello"
     assert dst.a == 2
     assert dst.b == "hello"
+
+
+def test_copy_deep_share_frozen() -> None:
+    leaf = FrozenLeaf(a=1, b="hello")
+    src = MutablePair(lhs=leaf, rhs=FrozenPair(lhs=leaf, rhs=leaf))
+    dst = src.copy_deep(share_frozen=True)
+    assert not src.eq_ptr(dst)
+    assert src.lhs.eq_ptr(dst.lhs)
+    assert src.rhs.eq_ptr(dst.rhs)
+    assert src.eq_s(dst)
+    with pytest.raises(AttributeError):
+        dst.lhs.a = 2  # type: ignore[misc]
+
+
+def test_copy_deep_share_frozen_with_mutable_child() -> None:
+    leaf = FrozenLeaf(a=1, b="hello")
+    src = FrozenPair(lhs=leaf, rhs=mlc.List([leaf]))
+    dst = src.copy_deep(share_frozen=True)
+    assert not src.eq_ptr(dst)
+    assert src.lhs.eq_ptr(dst.lhs)
+    assert not src.rhs.eq_ptr(dst.rhs)
+    assert dst.rhs[0].eq_ptr(leaf)
+
+
+def test_copy_deep_without_share_frozen() -> None:
+    leaf = FrozenLeaf(a=1, b="hello")
+    dst = copy.deepcopy(MutablePair(lhs=leaf, rhs=leaf))
+    assert not dst.lhs.eq_ptr(leaf)
+    assert dst.lhs.eq_ptr(dst.rhs)
+
+
+@pytest.mark.parametrize("num_threads", [1, 4])
+def test_copy_deep_num_threads(mlc_class_for_test: PyClassForTest, num_threads: int) -> None:
+    src = mlc.List([mlc_class_for_test, mlc.List([mlc_class_for_test]), CustomInit(a=1, b="hello")])
+    dst = src.copy_deep(num_threads=num_threads)
+    assert not src.eq_ptr(dst)
+    assert not src[0].eq_ptr(dst[0])
+    assert dst[0].eq_ptr(dst[1][0])
+    assert dst[2].a == 1 and dst[2].b == "hello"
+
+
+def test_copy_replace_dataclass_type_check() -> None:
+    leaf = FrozenLeaf(a=1, b="hello")
+    src = MutablePair(lhs=leaf, rhs=leaf)
+    dst = mlc.dataclasses.replace(src, rhs=mlc.List([1]))
+    assert dst.lhs.eq_ptr(leaf)
+    assert list(dst.rhs) == [1]
+    with pytest.raises((TypeError, ValueError)):
+        mlc.dataclasses.replace(src, lhs=mlc.List([1]))
+
+
+def test_copy_deep_json_roundtrip_dataclass() -> None:
+    leaf = FrozenLeaf(a=1, b="hello")
+    src = MutablePair(lhs=leaf, rhs=FrozenPair(lhs=leaf, rhs=mlc.List([leaf, None])))
+    for dst in (src.copy_deep(), mlc.Object.from_json(src.json())):
+        assert src.eq_s(dst)
+        assert isinstance(dst.rhs, FrozenPair)
+        assert dst.lhs.eq_ptr(dst.rhs.lhs)
+        assert dst.rhs.rhs[0].eq_ptr(dst.lhs)
+
+
+def test_copy_deep_func_keeps_signature() -> None:
+    src = mlc.List([mlc.List([1, 2]), mlc.Dict({"a": 3})])
+    dst = mlc.Func.get("mlc.core.CopyDeep")(src)
+    assert not dst.eq_ptr(src)
+    assert not dst[0].eq_ptr(src[0])
+    assert dst.eq_s(src)
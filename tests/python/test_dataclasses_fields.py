@@ -3,6 +3,7 @@ from typing import Union
 import mlc
 import numpy as np
 import pytest
+from mlc._cython import FieldAccessor
 from mlc.testing.dataclasses import CClassForTest, PyClassForTest, field_get, field_set
 
 MLCClassForTest = Union[CClassForTest, PyClassForTest]
@@ -641,3 +642,54 @@ def test_mlc_class_mem_fn(mlc_class_for_test: MLCClassForTest) -> None:
     obj = mlc_class_for_test
     assert obj.i64 == 64
     assert obj.i64_plus_one() == 65
+
+
+def test_mlc_class_field_accessor(mlc_class_for_test: MLCClassForTest) -> None:
+    obj = mlc_class_for_test
+    accessor = type(obj).i64
+    assert isinstance(accessor, FieldAccessor)
+    assert accessor.name == "i64"
+    assert accessor.get(obj) == 64
+    accessor.set(obj, 65)
+    assert obj.i64 == 65
+    with pytest.raises(AttributeError):
+        del obj.i64
+
+
+def test_mlc_class_gather_fields(mlc_class_for_test: MLCClassForTest) -> None:
+    objs = [mlc.dataclasses.replace(mlc_class_for_test, i64=i, f64=i / 2) for i in range(4)]
+    assert mlc.dataclasses.gather_fields(objs, "i64") == [0, 1, 2, 3]
+    assert mlc.dataclasses.gather_fields(objs, "str_") == ["world"] * 4
+    assert mlc.dataclasses.gather_fields(objs, "opt_f64") == [None] * 4
+    buffer = mlc.dataclasses.gather_fields(objs, "f64", as_buffer=True)
+    assert isinstance(buffer, memoryview)
+    assert buffer.format == "d"
+    assert np.array_equal(np.asarray(buffer), np.array([0.0, 0.5, 1.0, 1.5]))
+    assert mlc.dataclasses.gather_fields(objs, "bool_", as_buffer=True).tolist() == [False] * 4
+    assert mlc.dataclasses.gather_fields([], "i64", as_buffer=True).nbytes == 0
+    with pytest.raises(TypeError):
+        mlc.dataclasses.gather_fields(objs, "str_", as_buffer=True)
+    with pytest.raises(AttributeError):
+        mlc.dataclasses.gather_fields(objs, "not_a_field")
+    with pytest.raises(TypeError):
+        mlc.dataclasses.gather_fields([1, 2], "i64")
+
+
+def test_mlc_class_scatter_fields(mlc_class_for_test: MLCClassForTest) -> None:
+    objs = [mlc.dataclasses.replace(mlc_class_for_test) for _ in range(3)]
+    mlc.dataclasses.scatter_fields(objs, "i32", [7, 8, 9])
+    assert [obj.i32 for obj in objs] == [7, 8, 9]
+    mlc.dataclasses.scatter_fields(objs, "opt_i64", [None, 1, None])
+    assert [obj.opt_i64 for obj in objs] == [None, 1, None]
+    mlc.dataclasses.scatter_fields(objs, "bool_", np.array([True, False, True]))
+    assert [obj.bool_ for obj in objs] == [True, False, True]
+    mlc.dataclasses.scatter_fields(objs, "f64", np.arange(3, dtype=np.float64))
+    assert [obj.f64 for obj in objs] == [0.0, 1.0, 2.0]
+    mlc.dataclasses.scatter_fields(
+        objs, "i64", mlc.dataclasses.gather_fields(objs, "i32", as_buffer=True)
+    )
+    assert [obj.i64 for obj in objs] == [7, 8, 9]
+    with pytest.raises(ValueError):
+        mlc.dataclasses.scatter_fields(objs, "i64", [1, 2])
+    with pytest.raises(TypeError):
+        mlc.dataclasses.scatter_fields(objs, "bool_", [1, 0, 1])
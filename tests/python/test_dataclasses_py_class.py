@@ -1,7 +1,9 @@
+import inspect
 from typing import Optional
 
 import mlc
 import mlc.dataclasses as mlcd
+import pytest
 
 
 @mlcd.py_class("mlc.testing.py_class_base")
@@ -133,3 +135,38 @@ def test_derived_derived() -> None:
     assert str(obj) == (
         "mlc.testing.DerivedDerived(base_a=1, base_b=[1, 2], derived_a=2, derived_b='b', derived_derived_a='a')"
     )
+
+
+def test_init_binding() -> None:
+    # __init__(base_a, derived_a, base_b, derived_b)
+    obj = DerivedWithDefaultInterleaved(derived_a=2, base_a=1)
+    assert (obj.base_a, obj.derived_a, obj.derived_b) == (1, 2, "1234")
+    assert len(obj.base_b) == 0
+    assert not obj.base_b.eq_ptr(DerivedWithDefaultInterleaved(1, 2).base_b)
+    obj = DerivedWithDefaultInterleaved(1, 2, [3], derived_b=None)
+    assert (obj.base_a, obj.derived_a, list(obj.base_b), obj.derived_b) == (1, 2, [3], None)
+    assert list(inspect.signature(DerivedWithDefaultInterleaved.__init__).parameters) == [
+        "base_a",
+        "derived_a",
+        "base_b",
+        "derived_b",
+    ]
+    with pytest.raises(TypeError, match="missing a required argument: 'derived_a'"):
+        DerivedWithDefaultInterleaved(1)
+    with pytest.raises(TypeError, match="too many positional arguments"):
+        DerivedWithDefaultInterleaved(1, 2, [3], "4", 5)
+    with pytest.raises(TypeError, match="unexpected keyword argument 'c'"):
+        DerivedWithDefaultInterleaved(1, 2, c=3)
+    with pytest.raises(TypeError, match="multiple values for argument 'base_a'"):
+        DerivedWithDefaultInterleaved(1, 2, base_a=3)
+    with pytest.raises(TypeError, match="Failed to set field `derived_a`"):
+        DerivedWithDefaultInterleaved(1, "two")
+
+
+def test_gather_scatter_fields_mixed_types() -> None:
+    objs = [Base(base_a=1, base_b="a"), Derived(2, "b", 2.5, None), Base(3, "c")]
+    assert mlcd.gather_fields(objs, "base_a", as_buffer=True).tolist() == [1, 2, 3]
+    mlcd.scatter_fields(objs, "base_b", ["x", "y", "z"])
+    assert mlcd.gather_fields(objs, "base_b") == ["x", "y", "z"]
+    with pytest.raises(AttributeError):
+        mlcd.gather_fields(objs, "derived_a")
@@ -3,6 +3,7 @@ import pickle
 from typing import Optional
 
 import mlc
+import pytest
 
 
 @mlc.dataclasses.py_class("mlc.testing.serialize")
@@ -68,3 +69,23 @@ def test_json_opt_1() -> None:
     assert obj.b == obj_from_json.b
     assert obj.c == obj_from_json.c
     assert obj.d == obj_from_json.d
+
+
+@mlc.dataclasses.py_class("mlc.testing.serialize_list")
+class ObjTestList(mlc.PyClass):
+    x: mlc.List[int]
+
+
+def test_json_field_type_checked() -> None:
+    obj = ObjTestList.from_json(
+        '{"values": [[0, [1, 1], [1, 2]], [2, 0]], "type_keys": ["object.List", "int", "mlc.testing.serialize_list"]}'
+    )
+    assert list(obj.x) == [1, 2]
+    with pytest.raises(ValueError, match="Failed to set field `x`"):
+        ObjTestList.from_json(
+            '{"values": ["hello", [0, 0]], "type_keys": ["mlc.testing.serialize_list"]}'
+        )
+    with pytest.raises(ValueError, match="Failed to set field `x`"):
+        ObjTestList.from_json(
+            '{"values": [[0], [1, 0]], "type_keys": ["object.Dict", "mlc.testing.serialize_list"]}'
+        )
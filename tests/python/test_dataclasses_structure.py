@@ -349,3 +349,56 @@ def test_global_var() -> None:
     rhs = x + z + y
     lhs.eq_s(rhs, bind_free_vars=True, assert_mode=True)
     assert lhs.hash_s() == rhs.hash_s()
+
+
+def test_eq_s_no_assert() -> None:
+    x = Var("x")
+    y = Var("y")
+    cases = [
+        (x + y, x + y, True),
+        (x + y, y + x, True),
+        (x + x, x + y, True),
+        (Constant(1) + x, Constant(2) + x, True),
+        (Let(rhs=Constant(1), lhs=x, body=x), Let(rhs=Constant(1), lhs=y, body=x), True),
+        (
+            TensorType(shape=(1, 2), dtype="float32"),
+            TensorType(shape=(1, 2, 3), dtype="float32"),
+            False,
+        ),
+        (mlc.Dict({"a": x}), mlc.Dict({"b": x}), True),
+        (mlc.List([x, Constant(1)]), mlc.List([x, "1"]), True),
+        (x + y, x + y, False),
+    ]
+    for lhs, rhs, bind_free_vars in cases:
+        reason = lhs.eq_s_fail_reason(rhs, bind_free_vars=bind_free_vars)
+        assert lhs.eq_s(rhs, bind_free_vars=bind_free_vars) == (reason is None)
+
+
+def test_diff_s() -> None:
+    x = Var("x")
+    lhs = Let(rhs=Constant(1) + Constant(2), lhs=x, body=x + Constant(5))
+    rhs = Let(rhs=Constant(3) + Constant(2), lhs=x, body=x + Constant(6))
+    diffs = lhs.diff_s(rhs)
+    assert sorted((str(l), str(r), reason) for l, r, reason in diffs) == [
+        ("{root}.body.b.value", "{root}.body.b.value", "5 vs 6"),
+        ("{root}.rhs.a.value", "{root}.rhs.a.value", "1 vs 3"),
+    ]
+    assert len(lhs.diff_s(rhs, max_diffs=1)) == 1
+    assert lhs.diff_s(lhs) == []
+    diffs = mlc.List([1, 2, 3]).diff_s(mlc.List([1, 5]))
+    assert [(str(l), reason) for l, _, reason in diffs] == [
+        ("{root}[1]", "2 vs 5"),
+        ("{root}", "List length mismatch: 3 vs 2"),
+    ]
+
+
+def test_structural_funcs_keep_signatures() -> None:
+    x = Var("x")
+    lhs = Let(rhs=Constant(1), lhs=x, body=x)
+    rhs = Let(rhs=Constant(2), lhs=x, body=x)
+    assert mlc.Func.get("mlc.core.StructuralHash")(lhs) == lhs.hash_s()
+    assert mlc.Func.get("mlc.core.StructuralEqual")(lhs, lhs, True, False)
+    assert not mlc.Func.get("mlc.core.StructuralEqual")(lhs, rhs, True, False)
+    assert mlc.Func.get("mlc.core.StructuralEqualFailReason")(lhs, rhs, True) == (
+        lhs.eq_s_fail_reason(rhs)
+    )
@@ -1,4 +1,9 @@
+import io
+
+import mlc.dataclasses as mlcd
 import mlc.printer as mlcp
+import mlc.printer.ast as mlt
+import pytest
 from mlc.testing.toy_ir import Add, Assign, Func, Var
 
 
@@ -75,3 +80,94 @@ def test_print_bool() -> None:
     path = mlcp.ObjectPath.root()
     node = printer(True, path)
     assert node.to_python() == "True"
+
+
+def test_func_print_stream() -> None:
+    a = Var(name="a")
+    b = Var(name="b")
+    stmts = [Assign(lhs=Var(name=f"v{i}"), rhs=Add(a, b)) for i in range(5000)]
+    f = Func(name="f", args=[a, b], stmts=stmts, ret=a)
+    pieces: list[str] = []
+    mlcp.to_python_stream(f, pieces.append)
+    assert len(pieces) > 1
+    assert "".join(pieces) == mlcp.to_python(f)
+
+
+def test_func_print_stream_file() -> None:
+    a = Var(name="a")
+    f = Func(name="f", args=[a], stmts=[], ret=a)
+    out = io.StringIO()
+    mlcp.print_python(f, file=out)
+    assert out.getvalue() == mlcp.to_python(f)
+
+
+def test_func_print_style_file() -> None:
+    pytest.importorskip("pygments")
+    a = Var(name="a")
+    f = Func(name="f", args=[a], stmts=[], ret=a)
+    out = io.StringIO()
+    mlcp.print_python(f, style="ansi", file=out)
+    assert "\x1b[" in out.getvalue()
+    assert "\x1b[" not in mlcp.to_python(f)
+
+
+@mlcd.py_class("mlc.testing.printer.Notes")
+class Notes(mlcd.PyClass):
+    lines: list[str]
+
+    def __ir_print__(self, printer: mlcp.IRPrinter, path: mlcp.ObjectPath) -> mlt.Node:
+        return mlt.StmtBlock([mlt.ExprStmt(mlt.Id("x"), comment=line) for line in self.lines])
+
+
+@pytest.mark.parametrize("char", ["é", "中", "😀"])
+def test_print_stream_non_ascii(char: str) -> None:
+    # The text is streamed in 64 KiB chunks, and shifting it byte by byte cuts a character at every offset
+    for shift in range(4):
+        notes = Notes(lines=["_" * shift] + [char * 64] * 2000)
+        text = mlcp.to_python(notes)
+        pieces: list[str] = []
+        mlcp.to_python_stream(notes, pieces.append)
+        assert len(pieces) > 1
+        assert "".join(pieces) == text
+        out = io.StringIO()
+        mlcp.print_python(notes, file=out)
+        assert out.getvalue() == text
+
+
+def test_func_print_module() -> None:
+    funcs = []
+    for i in range(8):
+        a = Var(name="a")
+        b = Var(name=f"b{i}")
+        funcs.append(
+            Func(name=f"f{i}", args=[a, b], stmts=[Assign(lhs=Var(name="c"), rhs=Add(a, b))], ret=a)
+        )
+    expected = "\n\n".join(mlcp.to_python(f) for f in funcs)
+    assert mlcp.to_python_module(funcs, num_threads=1) == expected
+    assert mlcp.to_python_module(funcs, num_threads=4) == expected
+
+
+def test_func_print_underline() -> None:
+    a = Var(name="a")
+    b = Var(name="b")
+    c = Var(name="c")
+    d = Var(name="d")
+    e = Var(name="e")
+    stmts = [
+        Assign(lhs=d, rhs=Add(a, b)),
+        Assign(lhs=e, rhs=Add(d, c)),
+    ]
+    f = Func(name="f", args=[a, b, c], stmts=stmts, ret=e)
+    root = mlcp.ObjectPath.root()
+    cfg = mlcp.PrinterConfig(path_to_underline=[root["stmts"][1], root["stmts"][0]["b"]["a"]])
+    assert (
+        mlcp.to_python(f, cfg)
+        == """
+def f(a, b, c):
+  d = a + b
+      ^
+  e = d + c
+  ^^^^^^^^^
+  return e
+""".strip()
+    )